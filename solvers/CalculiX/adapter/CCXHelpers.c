@@ -92,6 +92,26 @@ void getNodeTemperatures( ITG * nodes, ITG numNodes, double * v, ITG mt, double
 	}
 }
 
+void getTemperatureComponent( double * v, ITG numNodes, ITG mt, double * temperatures )
+{
+	ITG i;
+
+	for( i = 0 ; i < numNodes ; i++ )
+	{
+		temperatures[i] = v[i * mt];
+	}
+}
+
+void setTemperatureComponent( double * temperatures, ITG numNodes, ITG mt, double * v )
+{
+	ITG i;
+
+	for( i = 0 ; i < numNodes ; i++ )
+	{
+		v[i * mt] = temperatures[i];
+	}
+}
+
 void getTetraFaceCenters( ITG * elements, ITG * faces, ITG numElements, ITG * kon, ITG * ipkon, double * co, double * faceCenters )
 {
 
@@ -161,6 +181,12 @@ void getTetraFaceNodes( ITG * elements, ITG * faces, ITG * nodes, ITG numElement
 	}
 }
 
+ITG getElementNumNodes( ITG element, char * lakon )
+{
+	// The label is padded with blanks to 8 characters, e.g. "C3D20R  "
+	return atoi( &lakon[element * 8 + 3] );
+}
+
 void getXloadIndices( char * loadType, ITG * elementIDs, ITG * faceIDs, ITG numElements, ITG nload, ITG * nelemload, char * sideload, ITG * xloadIndices )
 {
 
@@ -293,6 +319,249 @@ void setNodeTemperatures( double * temperatures, ITG numNodes, ITG * xbounIndice
 	}
 }
 
+double getXloadChange( double * xload, ITG * xloadIndices, double * values, ITG numValues, enum xloadVariable xloadVar )
+{
+	ITG i;
+	int indexOffset = getXloadIndexOffset( xloadVar );
+	double squaredDifference = 0, squaredNorm = 0;
+
+	for( i = 0 ; i < numValues ; i++ )
+	{
+		double difference = values[i] - xload[xloadIndices[i] + indexOffset];
+		squaredDifference += difference * difference;
+		squaredNorm += values[i] * values[i];
+	}
+
+	return ( squaredNorm > 0 ) ? sqrt( squaredDifference / squaredNorm ) : sqrt( squaredDifference );
+}
+
+double getXbounChange( double * xboun, ITG * xbounIndices, double * values, ITG numValues )
+{
+	ITG i;
+	double squaredDifference = 0, squaredNorm = 0;
+
+	for( i = 0 ; i < numValues ; i++ )
+	{
+		double difference = values[i] - xboun[xbounIndices[i]];
+		squaredDifference += difference * difference;
+		squaredNorm += values[i] * values[i];
+	}
+
+	return ( squaredNorm > 0 ) ? sqrt( squaredDifference / squaredNorm ) : sqrt( squaredDifference );
+}
+
+void multiplySymmetricMatrix( double * ad, double * au, ITG * jq, ITG * irow, ITG neq, double * x, double * y )
+{
+	ITG i, j;
+
+	for( i = 0 ; i < neq ; i++ )
+	{
+		y[i] = ad[i] * x[i];
+	}
+
+	// au contains the strict lower triangle, stored by columns
+	for( j = 0 ; j < neq ; j++ )
+	{
+		for( i = jq[j] - 1 ; i < jq[j + 1] - 1 ; i++ )
+		{
+			y[irow[i] - 1] += au[i] * x[j];
+			y[j] += au[i] * x[irow[i] - 1];
+		}
+	}
+}
+
+ITG solvePCG( double * ad, double * au, ITG * jq, ITG * irow, ITG neq, double * b, double * x, double tolerance, ITG maxIterations )
+{
+	ITG i, k;
+	double * r = malloc( neq * sizeof( double ) );
+	double * z = malloc( neq * sizeof( double ) );
+	double * p = malloc( neq * sizeof( double ) );
+	double * q = malloc( neq * sizeof( double ) );
+	double normB = 0, normR = 0, rz = 0, rzOld, alpha, beta, pq;
+
+	// Initial residual r = b - A x
+	multiplySymmetricMatrix( ad, au, jq, irow, neq, x, q );
+
+	for( i = 0 ; i < neq ; i++ )
+	{
+		r[i] = b[i] - q[i];
+		z[i] = r[i] / ad[i];
+		p[i] = z[i];
+		rz += r[i] * z[i];
+		normB += b[i] * b[i];
+		normR += r[i] * r[i];
+	}
+
+	normB = sqrt( normB );
+	normR = sqrt( normR );
+
+	for( k = 0 ; k < maxIterations && normR > tolerance * normB ; k++ )
+	{
+		multiplySymmetricMatrix( ad, au, jq, irow, neq, p, q );
+
+		pq = 0;
+		for( i = 0 ; i < neq ; i++ )
+		{
+			pq += p[i] * q[i];
+		}
+		alpha = rz / pq;
+
+		rzOld = rz;
+		rz = 0;
+		normR = 0;
+		for( i = 0 ; i < neq ; i++ )
+		{
+			x[i] += alpha * p[i];
+			r[i] -= alpha * q[i];
+			z[i] = r[i] / ad[i];
+			rz += r[i] * z[i];
+			normR += r[i] * r[i];
+		}
+		normR = sqrt( normR );
+
+		beta = rz / rzOld;
+		for( i = 0 ; i < neq ; i++ )
+		{
+			p[i] = z[i] + beta * p[i];
+		}
+	}
+
+	free( r );
+	free( z );
+	free( p );
+	free( q );
+
+	return ( normR > tolerance * normB ) ? -1 : k;
+}
+
+void * resizeWorkspace( Workspace * workspace, size_t size )
+{
+	if( workspace->data == NULL || size > workspace->size )
+	{
+		// Allocate at least one byte, such that the buffer is never NULL
+		workspace->data = realloc( workspace->data, size > 0 ? size : 1 );
+
+		if( workspace->data == NULL )
+		{
+			printf( "ERROR: Cannot allocate %zu bytes for the workspace of the coupling loop.\n", size );
+			fflush( stdout );
+			exit( EXIT_FAILURE );
+		}
+		workspace->size = size;
+	}
+
+	return workspace->data;
+}
+
+void * getWorkspace( Workspace * workspace, size_t size )
+{
+	void * data = resizeWorkspace( workspace, size );
+	memset( data, 0, size );
+	return data;
+}
+
+void freeWorkspace( Workspace * workspace )
+{
+	free( workspace->data );
+	workspace->data = NULL;
+	workspace->size = 0;
+}
+
+void clearCheckpointData( CheckpointData * checkpoint )
+{
+	checkpoint->numArrays = 0;
+}
+
+void addCheckpointArray( CheckpointData * checkpoint, double ** array, ITG count, ITG stride )
+{
+	if( checkpoint->numArrays == MAX_CHECKPOINT_ARRAYS )
+	{
+		printf( "ERROR: Too many arrays in a checkpoint (maximum %d).\n", MAX_CHECKPOINT_ARRAYS );
+		fflush( stdout );
+		exit( EXIT_FAILURE );
+	}
+
+	checkpoint->arrays[checkpoint->numArrays] = array;
+	checkpoint->counts[checkpoint->numArrays] = count;
+	checkpoint->strides[checkpoint->numArrays] = stride;
+	checkpoint->numArrays++;
+}
+
+void saveCheckpointData( CheckpointData * checkpoint )
+{
+	int i;
+	ITG j, size = 0;
+
+	for( i = 0 ; i < checkpoint->numArrays ; i++ )
+	{
+		size += checkpoint->counts[i];
+	}
+
+	double * buffer = resizeWorkspace( &checkpoint->buffer, sizeof( double ) * size );
+
+	for( i = 0 ; i < checkpoint->numArrays ; i++ )
+	{
+		double * array = *checkpoint->arrays[i];
+
+		if( checkpoint->strides[i] == 1 )
+		{
+			memcpy( buffer, array, sizeof( double ) * checkpoint->counts[i] );
+		}
+		else
+		{
+			for( j = 0 ; j < checkpoint->counts[i] ; j++ )
+			{
+				buffer[j] = array[j * checkpoint->strides[i]];
+			}
+		}
+		buffer += checkpoint->counts[i];
+	}
+}
+
+void restoreCheckpointData( CheckpointData * checkpoint )
+{
+	int i;
+	ITG j;
+	double * buffer = checkpoint->buffer.data;
+
+	for( i = 0 ; i < checkpoint->numArrays ; i++ )
+	{
+		double * array = *checkpoint->arrays[i];
+
+		if( checkpoint->strides[i] == 1 )
+		{
+			memcpy( array, buffer, sizeof( double ) * checkpoint->counts[i] );
+		}
+		else
+		{
+			for( j = 0 ; j < checkpoint->counts[i] ; j++ )
+			{
+				array[j * checkpoint->strides[i]] = buffer[j];
+			}
+		}
+		buffer += checkpoint->counts[i];
+	}
+}
+
+double * getCheckpointArray( CheckpointData * checkpoint, int index )
+{
+	int i;
+	double * buffer = checkpoint->buffer.data;
+
+	for( i = 0 ; i < index ; i++ )
+	{
+		buffer += checkpoint->counts[i];
+	}
+
+	return buffer;
+}
+
+void freeCheckpointData( CheckpointData * checkpoint )
+{
+	freeWorkspace( &checkpoint->buffer );
+	checkpoint->numArrays = 0;
+}
+
 bool isSteadyStateSimulation( ITG * nmethod )
 {
 	return *nmethod == 1;
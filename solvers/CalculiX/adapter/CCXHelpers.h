@@ -12,6 +12,7 @@
 #include <math.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include "../CalculiX.h"
 
 /*
@@ -26,6 +27,33 @@
  */
 enum xloadVariable { DFLUX, FILM_H, FILM_T };
 
+/**
+ * @brief Buffer that is kept over the increments of the coupling loop,
+ * instead of being allocated and freed in every increment
+ */
+typedef struct Workspace {
+	void * data;
+	size_t size;
+} Workspace;
+
+/**
+ * @brief Maximum number of arrays in a checkpoint
+ */
+#define MAX_CHECKPOINT_ARRAYS 16
+
+/**
+ * @brief Set of CalculiX arrays that are saved into and restored from one contiguous buffer.
+ * The arrays are given by the address of their pointer, such that they can be reallocated (RENEW)
+ * between saving and restoring.
+ */
+typedef struct CheckpointData {
+	int numArrays;
+	double ** arrays[MAX_CHECKPOINT_ARRAYS];
+	ITG counts[MAX_CHECKPOINT_ARRAYS];
+	ITG strides[MAX_CHECKPOINT_ARRAYS];
+	Workspace buffer;
+} CheckpointData;
+
 /**
  * @brief Returns node set name with internal CalculiX format
  * Prepends and appends an N: e.g. If the input name is "interface",
@@ -83,6 +111,24 @@ void getNodeCoordinates( ITG * nodes, ITG numNodes, double * co, double * coordi
  */
 void getNodeTemperatures( ITG * nodes, ITG numNodes, double * v, ITG mt, double * temperatures );
 
+/**
+ * @brief Copies the temperatures of all nodes into a contiguous array
+ * @param v: CalculiX array containing the temperatures (stride mt)
+ * @param numNodes: number of nodes
+ * @param mt: CalculiX variable with the number of degrees of freedom per node
+ * @param temperatures: output array with one temperature per node
+ */
+void getTemperatureComponent( double * v, ITG numNodes, ITG mt, double * temperatures );
+
+/**
+ * @brief Copies a contiguous array of temperatures into the temperature component of v (inverse of getTemperatureComponent)
+ * @param temperatures: array with one temperature per node
+ * @param numNodes: number of nodes
+ * @param mt: CalculiX variable with the number of degrees of freedom per node
+ * @param v: CalculiX array containing the temperatures (stride mt)
+ */
+void setTemperatureComponent( double * temperatures, ITG numNodes, ITG mt, double * v );
+
 /**
  * @brief Computes the center of one of the faces of a tetrahedral element
  * @param elements: input list of tetrahedral elements
@@ -108,6 +154,13 @@ void getTetraFaceCenters( ITG * elements, ITG * faces, ITG numElements, ITG * ko
  */
 void getTetraFaceNodes( ITG * elements, ITG * faces, ITG * nodes, ITG numElements, ITG numNodes, ITG * kon, ITG * ipkon, ITG * tetraFaceNodes );
 
+/**
+ * @brief Returns the number of nodes of a 3D solid element (e.g. 10 for C3D10 or 20 for C3D20R)
+ * @param element: element ID (starting at 0)
+ * @param lakon: CalculiX array with the element labels
+ */
+ITG getElementNumNodes( ITG element, char * lakon );
+
 /**
  * @brief Gets the indices of the xload where the DFLUX and FILM boundary conditions must be applied
  * @param loadType: DFLUX or FILM
@@ -132,6 +185,12 @@ void getXloadIndices( char * loadType, ITG * elementIDs, ITG * faceIDs, ITG numE
  */
 void getXbounIndices( ITG * nodes, ITG numNodes, ITG nboun, ITG * ikboun, ITG * ilboun, ITG * xbounIndices );
 
+/**
+ * @brief Returns the offset of a DFLUX or FILM variable with respect to the index of the load in xload
+ * @param xloadVar: DFLUX for heat flux, FILM_H for heat transfer coeff, FILM_T for sink temperature
+ */
+int getXloadIndexOffset( enum xloadVariable xloadVar );
+
 /**
  * @brief Modifies the values of a DFLUX or FILM boundary condition
  * @param xload: CalculiX array for the loads
@@ -178,6 +237,109 @@ void setFaceSinkTemperatures( double * sinkTemperatures, ITG numFaces, ITG * xlo
  */
 void setNodeTemperatures( double * temperatures, ITG numNodes, ITG * xbounIndices, double * xboun );
 
+/**
+ * @brief Returns the relative change (L2 norm) of DFLUX or FILM values with respect to the values stored in xload
+ * @param xload: CalculiX array for the loads
+ * @param xloadIndices: list of indices of the values in the xload array
+ * @param values: new boundary values
+ * @param numValues: number of boundary values provided
+ * @param xloadVar: variable that is compared: DFLUX for heat flux, FILM_H for heat transfer coeff, FILM_T for sink temperature
+ */
+double getXloadChange( double * xload, ITG * xloadIndices, double * values, ITG numValues, enum xloadVariable xloadVar );
+
+/**
+ * @brief Returns the relative change (L2 norm) of temperature values with respect to the values stored in xboun
+ * @param xboun: CalculiX array containing the assigned temperature boundary values
+ * @param xbounIndices: indices of the values in the xboun array
+ * @param values: new temperature values
+ * @param numValues: number of values provided
+ */
+double getXbounChange( double * xboun, ITG * xbounIndices, double * values, ITG numValues );
+
+/**
+ * @brief Computes y = A x for a symmetric matrix in CalculiX storage
+ * @param ad: diagonal of the matrix
+ * @param au: strict lower triangle of the matrix, stored by columns
+ * @param jq: CalculiX array with the (1-based) start of each column in au
+ * @param irow: CalculiX array with the (1-based) row of each entry in au
+ * @param neq: number of equations
+ * @param x: input vector
+ * @param y: output vector
+ */
+void multiplySymmetricMatrix( double * ad, double * au, ITG * jq, ITG * irow, ITG neq, double * x, double * y );
+
+/**
+ * @brief Solves a symmetric positive definite system in CalculiX storage with the Jacobi-preconditioned conjugate gradient method
+ * @param ad, au, jq, irow, neq: matrix, as for multiplySymmetricMatrix
+ * @param b: right-hand side
+ * @param x: initial guess as input, solution as output
+ * @param tolerance: required reduction of the residual norm relative to the norm of b
+ * @param maxIterations: maximum number of iterations
+ * @return number of iterations, or -1 if the tolerance was not reached
+ */
+ITG solvePCG( double * ad, double * au, ITG * jq, ITG * irow, ITG neq, double * b, double * x, double tolerance, ITG maxIterations );
+
+/**
+ * @brief Returns the buffer of a workspace, filled with zeros (like NNEW).
+ * The buffer is only reallocated if it is smaller than the requested size.
+ * @param workspace: workspace, initialized with { NULL, 0 }
+ * @param size: requested size in bytes
+ */
+void * getWorkspace( Workspace * workspace, size_t size );
+
+/**
+ * @brief Returns the buffer of a workspace, resized to at least the requested size, keeping its contents (like RENEW)
+ * @param workspace
+ * @param size: requested size in bytes
+ */
+void * resizeWorkspace( Workspace * workspace, size_t size );
+
+/**
+ * @brief Frees the buffer of a workspace
+ * @param workspace
+ */
+void freeWorkspace( Workspace * workspace );
+
+/**
+ * @brief Removes all arrays from a checkpoint (the buffer is kept for the next arrays)
+ * @param checkpoint: checkpoint, initialized with zeros
+ */
+void clearCheckpointData( CheckpointData * checkpoint );
+
+/**
+ * @brief Adds an array to a checkpoint
+ * @param checkpoint
+ * @param array: address of the CalculiX array
+ * @param count: number of values of the array that are stored
+ * @param stride: distance between two stored values in the array (e.g. mt for the temperatures of v)
+ */
+void addCheckpointArray( CheckpointData * checkpoint, double ** array, ITG count, ITG stride );
+
+/**
+ * @brief Copies all arrays of a checkpoint into its buffer
+ * @param checkpoint
+ */
+void saveCheckpointData( CheckpointData * checkpoint );
+
+/**
+ * @brief Copies the buffer of a checkpoint back into its arrays
+ * @param checkpoint
+ */
+void restoreCheckpointData( CheckpointData * checkpoint );
+
+/**
+ * @brief Returns the values of an array as stored in the buffer of a checkpoint (contiguous, without stride)
+ * @param checkpoint
+ * @param index: position of the array in the order of addCheckpointArray
+ */
+double * getCheckpointArray( CheckpointData * checkpoint, int index );
+
+/**
+ * @brief Frees the buffer of a checkpoint
+ * @param checkpoint
+ */
+void freeCheckpointData( CheckpointData * checkpoint );
+
 /**
  * @brief Returns whether it is a steady-state simulation based on the value of nmethod
  * @param nmethod: CalculiX variable with information regarding the type of analysis
@@ -7,7 +7,7 @@
 
 #include "ConfigReader.hpp"
 
-void ConfigReader_Read( char * configFilename, char * participantName, char ** preciceConfigFilename, InterfaceConfig ** interfaces, int * numInterface )
+void ConfigReader_Read( char * configFilename, char * participantName, char ** preciceConfigFilename, ParticipantConfig * participant, InterfaceConfig ** interfaces, int * numInterface )
 {
 
 	YAML::Node config = YAML::LoadFile( configFilename );
@@ -16,6 +16,62 @@ void ConfigReader_Read( char * configFilename, char * participantName, char ** p
 
 	*preciceConfigFilename = strdup( config["precice-config-file"].as<std::string>().c_str() );
 
+	// Linear solver for heat transfer: the solver selected in the input deck (default) or preconditioned CG
+	participant->usePCG = config["participants"][participantName]["linear-solver"]
+						  && config["participants"][participantName]["linear-solver"].as<std::string>() == "pcg";
+
+	if( config["participants"][participantName]["linear-solver-tolerance"] )
+	{
+		participant->pcgTolerance = config["participants"][participantName]["linear-solver-tolerance"].as<double>();
+	}
+	else
+	{
+		participant->pcgTolerance = 1e-8;
+	}
+
+	// Newton iterations of a repeated coupling iteration start from the last coupling iterate
+	participant->warmStart = config["participants"][participantName]["warm-start"]
+							 && config["participants"][participantName]["warm-start"].as<bool>();
+
+	// Newton tolerances loosened while the coupling data still changes (inexact coupling iterations)
+	participant->inexactCoupling = config["participants"][participantName]["inexact-coupling"]
+								   && config["participants"][participantName]["inexact-coupling"].as<bool>();
+
+	if( config["participants"][participantName]["inexact-coupling-max-tolerance"] )
+	{
+		participant->inexactCouplingMaxTolerance = config["participants"][participantName]["inexact-coupling-max-tolerance"].as<double>();
+	}
+	else
+	{
+		participant->inexactCouplingMaxTolerance = 0.1;
+	}
+
+	// Written data of the repeated coupling iterations obtained from the interface response of a linear increment
+	participant->useInterfaceOperator = config["participants"][participantName]["interface-operator"]
+										&& config["participants"][participantName]["interface-operator"].as<bool>();
+
+	if( config["participants"][participantName]["interface-operator-max-inputs"] )
+	{
+		participant->interfaceOperatorMaxInputs = config["participants"][participantName]["interface-operator-max-inputs"].as<int>();
+	}
+	else
+	{
+		participant->interfaceOperatorMaxInputs = 2000;
+	}
+
+	// Multi-rate coupling: one increment of the solid for several coupling windows
+	if( config["participants"][participantName]["multi-rate-windows"] )
+	{
+		participant->multiRateWindows = config["participants"][participantName]["multi-rate-windows"].as<int>();
+	}
+	else
+	{
+		participant->multiRateWindows = 1;
+	}
+
+	participant->multiRateLinearPrediction = config["participants"][participantName]["multi-rate-prediction"]
+											 && config["participants"][participantName]["multi-rate-prediction"].as<std::string>() == "linear";
+
 	*numInterface = config["participants"][participantName]["interfaces"].size();
 	*interfaces = (InterfaceConfig*) malloc( sizeof( InterfaceConfig ) * *numInterface );
 
@@ -111,6 +167,17 @@ void ConfigReader_CheckFields( YAML::Node & config, std::string participantName
 		exit( 1 );
 	}
 
+	if( config["participants"][participantName]["linear-solver"] )
+	{
+		std::string linearSolver = config["participants"][participantName]["linear-solver"].as<std::string>();
+
+		if( linearSolver != "default" && linearSolver != "pcg" )
+		{
+			std::cout << "ERROR: Participant '" << participantName << "' has an unknown 'linear-solver' (" << linearSolver << ") in the YAML configuration file. Valid values are 'default' and 'pcg'." << std::endl;
+			exit( 1 );
+		}
+	}
+
 	int numInterfaces = config["participants"][participantName]["interfaces"].size();
 
 	for( int i = 0 ; i < numInterfaces ; i++ )
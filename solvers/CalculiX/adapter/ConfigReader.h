@@ -18,7 +18,19 @@ typedef struct InterfaceConfig {
 	char ** readDataNames;
 } InterfaceConfig;
 
-void ConfigReader_Read(char * configFilename, char * participantName, char ** preciceConfigFilename, InterfaceConfig ** interfaces, int * numInterfaces);
+typedef struct ParticipantConfig {
+	int usePCG;
+	double pcgTolerance;
+	int warmStart;
+	int inexactCoupling;
+	double inexactCouplingMaxTolerance;
+	int useInterfaceOperator;
+	int interfaceOperatorMaxInputs;
+	int multiRateWindows;
+	int multiRateLinearPrediction;
+} ParticipantConfig;
+
+void ConfigReader_Read(char * configFilename, char * participantName, char ** preciceConfigFilename, ParticipantConfig * participant, InterfaceConfig ** interfaces, int * numInterfaces);
 
 
 #endif
@@ -10,6 +10,11 @@
 #include "ConfigReader.h"
 #include "precice/adapters/c/SolverInterfaceC.h"
 
+static void Precice_SetupInterfaceOperator( SimulationData * sim, ITG maxInputs );
+static void PreciceInterface_EvaluateWriteData( PreciceInterface * interface, SimulationData * sim, double * v, double * values, double * kDelta );
+static void Precice_AverageMultiRateData( SimulationData * sim );
+static void PreciceInterface_StoreMultiRateData( PreciceInterface * interface, SimulationData * sim, double * values, double * kDelta );
+
 
 void Precice_Setup( char * configFilename, char * participantName, SimulationData * sim )
 {
@@ -19,10 +24,25 @@ void Precice_Setup( char * configFilename, char * participantName, SimulationDat
 
 	int i;
 	char * preciceConfigFilename;
+	ParticipantConfig participant;
 	InterfaceConfig * interfaces;
 
 	// Read the YAML config file
-	ConfigReader_Read( configFilename, participantName, &preciceConfigFilename, &interfaces, &sim->numPreciceInterfaces );
+	ConfigReader_Read( configFilename, participantName, &preciceConfigFilename, &participant, &interfaces, &sim->numPreciceInterfaces );
+
+	sim->usePCG = participant.usePCG;
+	sim->pcgTolerance = participant.pcgTolerance;
+	sim->warmStart = participant.warmStart;
+	sim->inexactCoupling = participant.inexactCoupling;
+	sim->inexactCouplingMaxTolerance = participant.inexactCouplingMaxTolerance;
+	sim->useInterfaceOperator = participant.useInterfaceOperator;
+	sim->multiRateWindows = participant.multiRateWindows;
+	sim->multiRateLinearPrediction = participant.multiRateLinearPrediction;
+	sim->multiRateSolve = true;
+	sim->multiRateCount = 0;
+	sim->multiRateTime = 0;
+	sim->multiRateReadTime = 0;
+	sim->multiRateWriteCount = 0;
 
 	// Create the solver interface and configure it
 	precicec_createSolverInterface( participantName, preciceConfigFilename, 0, 1 );
@@ -36,11 +56,45 @@ void Precice_Setup( char * configFilename, char * participantName, SimulationDat
 		PreciceInterface_Create( sim->preciceInterfaces[i], sim, &interfaces[i] );
 	}
 	// Initialize variables needed for the coupling
-	NNEW( sim->coupling_init_v, double, sim->mt * sim->nk );
+	memset( &sim->coupling_checkpoint, 0, sizeof( CheckpointData ) );
+	sim->coupling_checkpoint_available = false;
+	sim->coupling_iterate_v = NULL;
+	sim->coupling_iterate_available = false;
+	sim->coupling_residual = 1;
+	sim->coupling_iteration = 0;
+	Precice_SetupInterfaceOperator( sim, participant.interfaceOperatorMaxInputs );
+
+	if( sim->usePCG )
+	{
+		printf( "Using the PCG solver for heat transfer, with warm start from the last coupling iteration\n" );
+	}
+
+	if( sim->warmStart )
+	{
+		printf( "Using the last coupling iteration as initial guess of the Newton iterations\n" );
+	}
+
+	if( sim->usePCG || sim->warmStart )
+	{
+		NNEW( sim->coupling_iterate_v, double, Precice_GetCheckpointSize( sim ) );
+	}
+
+	if( sim->multiRateWindows > 1 )
+	{
+		printf( "Using multi-rate coupling: one increment for up to %d coupling windows, with %s prediction of the written data\n",
+				sim->multiRateWindows, sim->multiRateLinearPrediction ? "linear" : "constant" );
+	}
 
 	// Initialize preCICE
 	sim->precice_dt = precicec_initialize();
 
+	// The windows of a multi-rate increment are not repeated, so there is nothing to checkpoint
+	if( sim->multiRateWindows > 1 && Precice_IsWriteCheckpointRequired() )
+	{
+		printf( "ERROR: Multi-rate coupling (multi-rate-windows > 1) requires an explicit coupling scheme.\n" );
+		exit( EXIT_FAILURE );
+	}
+
 	// Initialize coupling data
 	Precice_InitializeData( sim );
 
@@ -70,6 +124,36 @@ void Precice_AdjustSolverTimestep( SimulationData * sim )
 		// Set the solver time step to be the same as the coupling time step
 		// sim->solver_dt = sim->precice_dt;
         sim->solver_dt = 1;
+		sim->multiRateSolve = true;
+	}
+	else if( sim->multiRateWindows > 1 && ( sim->multiRateTime > 0 || sim->precice_dt < *sim->dtheta * *sim->tper ) )
+	{
+		// Multi-rate coupling: the increment ends with the window that completes multiRateWindows windows,
+		// or before the increment would exceed the step size of CalculiX or the end of the step
+		double incrementTime = sim->multiRateTime + sim->precice_dt;
+
+		if( incrementTime > *sim->dtheta * *sim->tper * ( 1 + 1e-10 ) )
+		{
+			printf( "ERROR: The increment was cut back to %e, below the %e of the coupling windows of the multi-rate increment. Please reduce multi-rate-windows.\n",
+					*sim->dtheta * *sim->tper, incrementTime );
+			exit( EXIT_FAILURE );
+		}
+
+		sim->multiRateSolve = sim->multiRateCount + 1 >= sim->multiRateWindows
+							  || incrementTime + sim->precice_dt > *sim->dtheta * *sim->tper * ( 1 + 1e-10 )
+							  || *sim->theta + ( incrementTime + sim->precice_dt ) / *sim->tper > 1 + 1e-10;
+
+		printf( "Adjusting time step for multi-rate transient step\n" );
+		printf( "coupling window %d of the increment, increment time = %f, solving: %s\n", sim->multiRateCount + 1, incrementTime, sim->multiRateSolve ? "yes" : "no" );
+		fflush( stdout );
+
+		if( sim->multiRateSolve )
+		{
+			*sim->dtheta = incrementTime / *sim->tper;
+		}
+
+		// preCICE advances by one window
+		sim->solver_dt = sim->precice_dt;
 	}
 	else
 	{
@@ -82,7 +166,10 @@ void Precice_AdjustSolverTimestep( SimulationData * sim )
 
 		// Compute the non-normalized time step used by preCICE
 		sim->solver_dt = ( *sim->dtheta ) * ( *sim->tper );
+		sim->multiRateSolve = true;
 	}
+
+	sim->coupling_increment_theta = *sim->theta;
 }
 
 void Precice_Advance( SimulationData * sim )
@@ -91,6 +178,18 @@ void Precice_Advance( SimulationData * sim )
 	fflush( stdout );
 
 	sim->precice_dt = precicec_advance( sim->solver_dt );
+
+	// Windows of the current multi-rate increment
+	if( sim->multiRateSolve )
+	{
+		sim->multiRateCount = 0;
+		sim->multiRateTime = 0;
+	}
+	else
+	{
+		sim->multiRateCount++;
+		sim->multiRateTime += sim->solver_dt;
+	}
 }
 
 bool Precice_IsCouplingOngoing()
@@ -118,37 +217,91 @@ void Precice_FulfilledWriteCheckpoint()
 	precicec_fulfilledAction( "write-iteration-checkpoint" );
 }
 
+ITG Precice_GetCheckpointSize( SimulationData * sim )
+{
+	// In a heat transfer analysis, the displacement degrees of freedom of v are not used
+	return sim->thermalOnly ? sim->nk : sim->mt * sim->nk;
+}
+
+void Precice_SaveSolution( SimulationData * sim, double * v, double * checkpoint )
+{
+	if( sim->thermalOnly )
+	{
+		getTemperatureComponent( v, sim->nk, sim->mt, checkpoint );
+	}
+	else
+	{
+		memcpy( checkpoint, v, sizeof( double ) * sim->mt * sim->nk );
+	}
+}
+
+void Precice_BeginIterationCheckpoint( SimulationData * sim, double ** v )
+{
+	clearCheckpointData( &sim->coupling_checkpoint );
+
+	// In a heat transfer analysis, only the temperatures of the solution are stored
+	if( sim->thermalOnly )
+	{
+		addCheckpointArray( &sim->coupling_checkpoint, v, sim->nk, sim->mt );
+	}
+	else
+	{
+		addCheckpointArray( &sim->coupling_checkpoint, v, sim->mt * sim->nk, 1 );
+	}
+}
+
+void Precice_AddCheckpointArray( SimulationData * sim, double ** array, ITG count, ITG stride )
+{
+	addCheckpointArray( &sim->coupling_checkpoint, array, count, stride );
+}
+
 void Precice_ReadIterationCheckpoint( SimulationData * sim, double * v )
 {
 
 	printf( "Adapter reading checkpoint...\n" );
 	fflush( stdout );
 
+	// Keep the last iterate as initial guess for the next coupling iteration
+	if( sim->coupling_iterate_v != NULL )
+	{
+		Precice_SaveSolution( sim, v, sim->coupling_iterate_v );
+		sim->coupling_iterate_theta = *( sim->theta );
+		sim->coupling_iterate_available = true;
+	}
+
+	sim->coupling_iteration++;
+
 	// Reload time
 	*( sim->theta ) = sim->coupling_init_theta;
 
 	// Reload step size
 	*( sim->dtheta ) = sim->coupling_init_dtheta;
 
-	// Reload solution vector v
-	memcpy( v, sim->coupling_init_v, sizeof( double ) * sim->mt * sim->nk );
+	// Reload the solution and the state of the increment
+	restoreCheckpointData( &sim->coupling_checkpoint );
 
 }
 
-void Precice_WriteIterationCheckpoint( SimulationData * sim, double * v )
+void Precice_WriteIterationCheckpoint( SimulationData * sim )
 {
 
 	printf( "Adapter writing checkpoint...\n" );
 	fflush( stdout );
 
+	// The iterate of the previous window is not valid for the new window
+	sim->coupling_iterate_available = false;
+	sim->interfaceOperator.referenceAvailable = false;
+	sim->coupling_iteration = 0;
+
 	// Save time
 	sim->coupling_init_theta = *( sim->theta );
 
 	// Save step size
 	sim->coupling_init_dtheta = *( sim->dtheta );
 
-	// Save solution vector v
-	memcpy( sim->coupling_init_v, v, sizeof( double ) * sim->mt * sim->nk );
+	// Save the solution and the state of the increment
+	saveCheckpointData( &sim->coupling_checkpoint );
+	sim->coupling_checkpoint_available = true;
 
 }
 
@@ -164,6 +317,9 @@ void Precice_ReadCouplingData( SimulationData * sim )
 
 	if( precicec_isReadDataAvailable() )
 	{
+		// The coupling residual is the largest relative change of the read data
+		sim->coupling_residual = 0;
+
 		for( i = 0 ; i < numInterfaces ; i++ )
 		{
 			switch( interfaces[i]->readData )
@@ -171,26 +327,237 @@ void Precice_ReadCouplingData( SimulationData * sim )
 			case TEMPERATURE:
 				// Read and set temperature BC
 				precicec_readBlockScalarData( interfaces[i]->temperatureDataID, interfaces[i]->numNodes, interfaces[i]->preciceNodeIDs, interfaces[i]->nodeData );
+				sim->coupling_residual = fmax( sim->coupling_residual, getXbounChange( sim->xboun, interfaces[i]->xbounIndices, interfaces[i]->nodeData, interfaces[i]->numNodes ) );
 				setNodeTemperatures( interfaces[i]->nodeData, interfaces[i]->numNodes, interfaces[i]->xbounIndices, sim->xboun );
 				break;
 			case HEAT_FLUX:
 				// Read and set heat flux BC
 				precicec_readBlockScalarData( interfaces[i]->fluxDataID, interfaces[i]->numElements, interfaces[i]->preciceFaceCenterIDs, interfaces[i]->faceCenterData );
+				sim->coupling_residual = fmax( sim->coupling_residual, getXloadChange( sim->xload, interfaces[i]->xloadIndices, interfaces[i]->faceCenterData, interfaces[i]->numElements, DFLUX ) );
 				setFaceFluxes( interfaces[i]->faceCenterData, interfaces[i]->numElements, interfaces[i]->xloadIndices, sim->xload );
 				break;
 			case CONVECTION:
 				// Read and set sink temperature in convective film BC
 				precicec_readBlockScalarData( interfaces[i]->kDeltaTemperatureReadDataID, interfaces[i]->numElements, interfaces[i]->preciceFaceCenterIDs, interfaces[i]->faceCenterData );
+				sim->coupling_residual = fmax( sim->coupling_residual, getXloadChange( sim->xload, interfaces[i]->xloadIndices, interfaces[i]->faceCenterData, interfaces[i]->numElements, FILM_T ) );
 				setFaceSinkTemperatures( interfaces[i]->faceCenterData, interfaces[i]->numElements, interfaces[i]->xloadIndices, sim->xload );
 				// Read and set heat transfer coefficient in convective film BC
 				precicec_readBlockScalarData( interfaces[i]->kDeltaReadDataID, interfaces[i]->numElements, interfaces[i]->preciceFaceCenterIDs, interfaces[i]->faceCenterData );
+				sim->coupling_residual = fmax( sim->coupling_residual, getXloadChange( sim->xload, interfaces[i]->xloadIndices, interfaces[i]->faceCenterData, interfaces[i]->numElements, FILM_H ) );
 				setFaceHeatTransferCoefficients( interfaces[i]->faceCenterData, interfaces[i]->numElements, interfaces[i]->xloadIndices, sim->xload );
 				break;
 			}
 		}
+
+		printf( "Relative change of the coupling data: %e\n", sim->coupling_residual );
+		fflush( stdout );
+
+		if( sim->multiRateWindows > 1 )
+		{
+			Precice_AverageMultiRateData( sim );
+		}
 	}
 }
 
+static void Precice_AverageMultiRateData( SimulationData * sim )
+{
+	PreciceInterface ** interfaces = sim->preciceInterfaces;
+	double weight = sim->solver_dt;
+	int i;
+	ITG k;
+
+	sim->multiRateReadTime += weight;
+
+	for( i = 0 ; i < sim->numPreciceInterfaces ; i++ )
+	{
+		double * sum = interfaces[i]->multiRateReadSum;
+		double * weightedSum = interfaces[i]->multiRateReadWeightedSum;
+
+		switch( interfaces[i]->readData )
+		{
+		case TEMPERATURE:
+			for( k = 0 ; k < interfaces[i]->numNodes ; k++ )
+			{
+				double * temperature = &sim->xboun[interfaces[i]->xbounIndices[k]];
+				sum[k] += weight * *temperature;
+				if( sim->multiRateSolve ) *temperature = sum[k] / sim->multiRateReadTime;
+			}
+			break;
+		case HEAT_FLUX:
+			for( k = 0 ; k < interfaces[i]->numElements ; k++ )
+			{
+				double * flux = &sim->xload[interfaces[i]->xloadIndices[k] + getXloadIndexOffset( DFLUX )];
+				sum[k] += weight * *flux;
+				if( sim->multiRateSolve ) *flux = sum[k] / sim->multiRateReadTime;
+			}
+			break;
+		case CONVECTION:
+			// The sink temperature is weighted with the heat transfer coefficient, such that the
+			// average heat flux into a face at constant temperature is the average of the heat fluxes
+			for( k = 0 ; k < interfaces[i]->numElements ; k++ )
+			{
+				double * coefficient = &sim->xload[interfaces[i]->xloadIndices[k] + getXloadIndexOffset( FILM_H )];
+				double * sinkTemperature = &sim->xload[interfaces[i]->xloadIndices[k] + getXloadIndexOffset( FILM_T )];
+				sum[k] += weight * *coefficient;
+				weightedSum[k] += weight * *coefficient * *sinkTemperature;
+				if( sim->multiRateSolve )
+				{
+					*coefficient = sum[k] / sim->multiRateReadTime;
+					if( sum[k] > 0 ) *sinkTemperature = weightedSum[k] / sum[k];
+				}
+			}
+			break;
+		}
+
+		if( sim->multiRateSolve )
+		{
+			ITG numValues = ( interfaces[i]->readData == TEMPERATURE ) ? interfaces[i]->numNodes : interfaces[i]->numElements;
+			memset( sum, 0, numValues * sizeof( double ) );
+			memset( weightedSum, 0, numValues * sizeof( double ) );
+		}
+	}
+
+	if( sim->multiRateSolve )
+	{
+		printf( "Adapter averaging the coupling data over %e\n", sim->multiRateReadTime );
+		fflush( stdout );
+		sim->multiRateReadTime = 0;
+	}
+}
+
+double Precice_GetIterateFraction( SimulationData * sim )
+{
+	double fraction;
+
+	if( !sim->coupling_iterate_available || sim->coupling_iterate_theta <= sim->coupling_init_theta )
+	{
+		return -1;
+	}
+
+	// Linear interpolation between the checkpoint and the last iterate, at the end of the current increment
+	fraction = ( *sim->theta + *sim->dtheta - sim->coupling_init_theta ) / ( sim->coupling_iterate_theta - sim->coupling_init_theta );
+	return fmin( fmax( fraction, 0 ), 1 );
+}
+
+void Precice_WarmStartSolution( SimulationData * sim, ITG * nactdof, double * v )
+{
+	ITG i;
+	ITG numNodes = sim->nk;
+	ITG stride = sim->thermalOnly ? 1 : sim->mt;
+	double fraction = Precice_GetIterateFraction( sim );
+	double * initialSolution = getCheckpointArray( &sim->coupling_checkpoint, 0 );
+
+	if( fraction < 0 )
+	{
+		return;
+	}
+
+	printf( "Adapter starting the Newton iterations from the last coupling iterate\n" );
+	fflush( stdout );
+
+	for( i = 0 ; i < numNodes ; i++ )
+	{
+		// Only the free temperatures: the constrained ones are set by the boundary conditions
+		if( nactdof[i * sim->mt] > 0 )
+		{
+			double initialTemperature = initialSolution[i * stride];
+			v[i * sim->mt] = initialTemperature + fraction * ( sim->coupling_iterate_v[i * stride] - initialTemperature );
+		}
+	}
+}
+
+void Precice_GetIterateCorrection( SimulationData * sim, ITG * nactdof, ITG neq, double * x )
+{
+	ITG i, dof;
+	ITG numNodes = sim->nk;
+	ITG stride = sim->thermalOnly ? 1 : sim->mt;
+	double fraction = Precice_GetIterateFraction( sim );
+	double * initialSolution = getCheckpointArray( &sim->coupling_checkpoint, 0 );
+
+	memset( x, 0, neq * sizeof( double ) );
+
+	if( fraction < 0 )
+	{
+		return;
+	}
+
+	for( i = 0 ; i < numNodes ; i++ )
+	{
+		// Equation of the temperature degree of freedom of the node (not positive if it is constrained)
+		dof = nactdof[i * sim->mt];
+
+		if( dof > 0 )
+		{
+			double initialTemperature = initialSolution[i * stride];
+			double guess = initialTemperature + fraction * ( sim->coupling_iterate_v[i * stride] - initialTemperature );
+			x[dof - 1] = guess - sim->vold[i * sim->mt];
+		}
+	}
+}
+
+double Precice_GetLinearSolverTolerance( SimulationData * sim )
+{
+	return fmax( sim->pcgTolerance, fmin( 1e-3, 0.1 * sim->coupling_residual ) );
+}
+
+double Precice_GetInexactCouplingTolerance( SimulationData * sim )
+{
+	double tolerance;
+
+	// Without checkpoints (explicit coupling), every solution is final
+	if( !sim->inexactCoupling || !sim->coupling_checkpoint_available )
+	{
+		return 0;
+	}
+
+	// The change of the read data is not known in the first iteration of a window
+	if( sim->coupling_iteration == 0 )
+	{
+		tolerance = sim->inexactCouplingMaxTolerance;
+	}
+	else
+	{
+		tolerance = fmin( sim->inexactCouplingMaxTolerance, 0.1 * sim->coupling_residual );
+	}
+
+	printf( "Coupling iteration %d: Newton tolerances of at least %e\n", sim->coupling_iteration, tolerance );
+	fflush( stdout );
+
+	return tolerance;
+}
+
+ITG Precice_MarkCoupledLoadElements( SimulationData * sim, ITG * isCoupled )
+{
+
+	PreciceInterface ** interfaces = sim->preciceInterfaces;
+	int numInterfaces = sim->numPreciceInterfaces;
+	ITG numCoupledElements = 0;
+	int i;
+	ITG k;
+
+	for( i = 0 ; i < numInterfaces ; i++ )
+	{
+		// Only the DFLUX and FILM loads are changed by the adapter
+		if( interfaces[i]->xloadIndices == NULL )
+		{
+			continue;
+		}
+
+		for( k = 0 ; k < interfaces[i]->numElements ; k++ )
+		{
+			ITG elementID = ( *sim->nelemload )[interfaces[i]->xloadIndices[k]];
+
+			if( isCoupled[elementID - 1] == 0 )
+			{
+				isCoupled[elementID - 1] = 1;
+				numCoupledElements++;
+			}
+		}
+	}
+
+	return numCoupledElements;
+}
+
 void Precice_WriteCouplingData( SimulationData * sim )
 {
 
@@ -200,65 +567,48 @@ void Precice_WriteCouplingData( SimulationData * sim )
 	PreciceInterface ** interfaces = sim->preciceInterfaces;
 	int numInterfaces = sim->numPreciceInterfaces;
 	int i;
-	int iset;
 
 	if( precicec_isWriteDataRequired( sim->solver_dt ) || precicec_isActionRequired( "write-initial-data" ) )
 	{
+		// Multi-rate coupling: the data of a new increment becomes the last one
+		if( sim->multiRateWindows > 1 && ( sim->multiRateWriteCount == 0 || *sim->theta > sim->multiRateWriteTheta ) )
+		{
+			for( i = 0 ; i < numInterfaces ; i++ )
+			{
+				double * previous = interfaces[i]->multiRatePreviousWriteData;
+				interfaces[i]->multiRatePreviousWriteData = interfaces[i]->multiRateWriteData;
+				interfaces[i]->multiRateWriteData = previous;
+			}
+			sim->multiRatePreviousWriteTheta = sim->multiRateWriteTheta;
+			sim->multiRateWriteTheta = *sim->theta;
+			sim->multiRateWriteCount++;
+		}
+
 		for( i = 0 ; i < numInterfaces ; i++ )
 		{
 			switch( interfaces[i]->writeData )
 			{
 			case TEMPERATURE:
-				getNodeTemperatures( interfaces[i]->nodeIDs, interfaces[i]->numNodes, sim->vold, sim->mt, interfaces[i]->nodeData );
+				PreciceInterface_EvaluateWriteData( interfaces[i], sim, sim->vold, interfaces[i]->nodeData, NULL );
+				PreciceInterface_StoreMultiRateData( interfaces[i], sim, interfaces[i]->nodeData, NULL );
 				precicec_writeBlockScalarData( interfaces[i]->temperatureDataID, interfaces[i]->numNodes, interfaces[i]->preciceNodeIDs, interfaces[i]->nodeData );
 				break;
 			case HEAT_FLUX:
-				iset = interfaces[i]->faceSetID + 1; // Adjust index before calling Fortran function
-				FORTRAN( getflux, ( sim->co,
-									sim->ntmat_,
-									sim->vold,
-									sim->cocon,
-									sim->ncocon,
-									&iset,
-									sim->istartset,
-									sim->iendset,
-									*sim->ipkon,
-									*sim->lakon,
-									*sim->kon,
-									sim->ialset,
-									*sim->ielmat,
-									sim->mi,
-									interfaces[i]->faceCenterData
-									)
-						 );
+				PreciceInterface_EvaluateWriteData( interfaces[i], sim, sim->vold, interfaces[i]->faceCenterData, NULL );
+				PreciceInterface_StoreMultiRateData( interfaces[i], sim, interfaces[i]->faceCenterData, NULL );
 				precicec_writeBlockScalarData( interfaces[i]->fluxDataID, interfaces[i]->numElements, interfaces[i]->preciceFaceCenterIDs, interfaces[i]->faceCenterData );
 				break;
 			case CONVECTION:
-				iset = interfaces[i]->faceSetID + 1; // Adjust index before calling Fortran function
-				double * myKDelta = malloc( interfaces[i]->numElements * sizeof( double ) );
-				double * T = malloc( interfaces[i]->numElements * sizeof( double ) );
-				FORTRAN( getkdeltatemp, ( sim->co,
-										  sim->ntmat_,
-										  sim->vold,
-										  sim->cocon,
-										  sim->ncocon,
-										  &iset,
-										  sim->istartset,
-										  sim->iendset,
-										  *sim->ipkon,
-										  *sim->lakon,
-										  *sim->kon,
-										  sim->ialset,
-										  *sim->ielmat,
-										  sim->mi,
-										  myKDelta,
-										  T
-										  )
-						 );
-				precicec_writeBlockScalarData( interfaces[i]->kDeltaWriteDataID, interfaces[i]->numElements, interfaces[i]->preciceFaceCenterIDs, myKDelta );
-				precicec_writeBlockScalarData( interfaces[i]->kDeltaTemperatureWriteDataID, interfaces[i]->numElements, interfaces[i]->preciceFaceCenterIDs, T );
-				free( myKDelta );
-				free( T );
+				{
+					double * myKDelta = malloc( interfaces[i]->numElements * sizeof( double ) );
+					double * T = malloc( interfaces[i]->numElements * sizeof( double ) );
+					PreciceInterface_EvaluateWriteData( interfaces[i], sim, sim->vold, T, myKDelta );
+					PreciceInterface_StoreMultiRateData( interfaces[i], sim, T, myKDelta );
+					precicec_writeBlockScalarData( interfaces[i]->kDeltaWriteDataID, interfaces[i]->numElements, interfaces[i]->preciceFaceCenterIDs, myKDelta );
+					precicec_writeBlockScalarData( interfaces[i]->kDeltaTemperatureWriteDataID, interfaces[i]->numElements, interfaces[i]->preciceFaceCenterIDs, T );
+					free( myKDelta );
+					free( T );
+				}
 				break;
 
 			}
@@ -272,11 +622,551 @@ void Precice_WriteCouplingData( SimulationData * sim )
 	}
 }
 
+static void PreciceInterface_StoreMultiRateData( PreciceInterface * interface, SimulationData * sim, double * values, double * kDelta )
+{
+	ITG numValues = ( interface->writeData == TEMPERATURE ) ? interface->numNodes : interface->numElements;
+
+	if( sim->multiRateWindows <= 1 )
+	{
+		return;
+	}
+
+	if( interface->writeData == CONVECTION )
+	{
+		memcpy( interface->multiRateWriteData, kDelta, numValues * sizeof( double ) );
+		memcpy( &interface->multiRateWriteData[numValues], values, numValues * sizeof( double ) );
+	}
+	else
+	{
+		memcpy( interface->multiRateWriteData, values, numValues * sizeof( double ) );
+	}
+}
+
+void Precice_WriteMultiRateData( SimulationData * sim )
+{
+	PreciceInterface ** interfaces = sim->preciceInterfaces;
+	double factor = 0;
+	double theta;
+	int i;
+	ITG k;
+
+	// Without a solved increment, the data of the current state is written (and kept)
+	if( sim->multiRateWriteCount == 0 )
+	{
+		Precice_WriteCouplingData( sim );
+		return;
+	}
+
+	printf( "Adapter writing coupling data of the last increment (multi-rate coupling)...\n" );
+	fflush( stdout );
+
+	if( !precicec_isWriteDataRequired( sim->solver_dt ) )
+	{
+		return;
+	}
+
+	// Linear extrapolation in time from the last two increments to the end of the window
+	if( sim->multiRateLinearPrediction && sim->multiRateWriteCount > 1 && sim->multiRateWriteTheta > sim->multiRatePreviousWriteTheta )
+	{
+		theta = *sim->theta + ( sim->multiRateTime + sim->solver_dt ) / *sim->tper;
+		factor = ( theta - sim->multiRateWriteTheta ) / ( sim->multiRateWriteTheta - sim->multiRatePreviousWriteTheta );
+	}
+
+	for( i = 0 ; i < sim->numPreciceInterfaces ; i++ )
+	{
+		ITG numValues = ( interfaces[i]->writeData == TEMPERATURE ) ? interfaces[i]->numNodes : interfaces[i]->numElements;
+		ITG numStoredValues = ( interfaces[i]->writeData == CONVECTION ) ? 2 * numValues : numValues;
+		double * last = interfaces[i]->multiRateWriteData;
+		double * previous = interfaces[i]->multiRatePreviousWriteData;
+		double * values = malloc( numStoredValues * sizeof( double ) );
+
+		for( k = 0 ; k < numStoredValues ; k++ )
+		{
+			values[k] = last[k] + factor * ( last[k] - previous[k] );
+		}
+
+		switch( interfaces[i]->writeData )
+		{
+		case TEMPERATURE:
+			precicec_writeBlockScalarData( interfaces[i]->temperatureDataID, interfaces[i]->numNodes, interfaces[i]->preciceNodeIDs, values );
+			break;
+		case HEAT_FLUX:
+			precicec_writeBlockScalarData( interfaces[i]->fluxDataID, interfaces[i]->numElements, interfaces[i]->preciceFaceCenterIDs, values );
+			break;
+		case CONVECTION:
+			precicec_writeBlockScalarData( interfaces[i]->kDeltaWriteDataID, interfaces[i]->numElements, interfaces[i]->preciceFaceCenterIDs, values );
+			precicec_writeBlockScalarData( interfaces[i]->kDeltaTemperatureWriteDataID, interfaces[i]->numElements, interfaces[i]->preciceFaceCenterIDs, &values[numValues] );
+			break;
+		}
+
+		free( values );
+	}
+}
+
+static bool Precice_CoversCouplingWindow( SimulationData * sim )
+{
+	// The increment starts at the checkpoint and ends at the end of the window (no subcycling)
+	return sim->coupling_checkpoint_available
+		   && sim->coupling_increment_theta == sim->coupling_init_theta
+		   && sim->solver_dt >= sim->precice_dt * ( 1 - 1e-10 );
+}
+
+static void Precice_SetupInterfaceOperator( SimulationData * sim, ITG maxInputs )
+{
+	InterfaceOperator * op = &sim->interfaceOperator;
+	PreciceInterface ** interfaces = sim->preciceInterfaces;
+	int numInterfaces = sim->numPreciceInterfaces;
+	ITG * kon = *sim->kon;
+	ITG * ipkon = *sim->ipkon;
+	char * lakon = *sim->lakon;
+	ITG * nodeColors;
+	ITG numColored = 0;
+	ITG n = 0, c = 0;
+	ITG j, k;
+	int i;
+
+	memset( op, 0, sizeof( InterfaceOperator ) );
+
+	if( !sim->useInterfaceOperator )
+	{
+		return;
+	}
+
+	for( i = 0 ; i < numInterfaces ; i++ )
+	{
+		// A change of the temperature boundary conditions changes the equations that are solved
+		if( interfaces[i]->readData == TEMPERATURE )
+		{
+			printf( "The interface response is not used, because interface %s reads temperatures\n", interfaces[i]->name );
+			sim->useInterfaceOperator = 0;
+			return;
+		}
+
+		op->numInputs += interfaces[i]->numElements;
+
+		if( interfaces[i]->readData == CONVECTION )
+		{
+			op->numCoefficients += interfaces[i]->numElements;
+		}
+
+		op->numOutputs += ( interfaces[i]->writeData == TEMPERATURE ) ? interfaces[i]->numNodes : interfaces[i]->numElements;
+	}
+
+	if( op->numInputs > maxInputs )
+	{
+		printf( "The interface response is not used, because the interfaces have more than %d read values\n", (int) maxInputs );
+		memset( op, 0, sizeof( InterfaceOperator ) );
+		sim->useInterfaceOperator = 0;
+		return;
+	}
+
+	op->inputIndices = malloc( op->numInputs * sizeof( ITG ) );
+	op->inputElements = malloc( op->numInputs * sizeof( ITG ) );
+	op->inputColors = malloc( op->numInputs * sizeof( ITG ) );
+	op->referenceInputs = malloc( op->numInputs * sizeof( double ) );
+	op->savedInputs = malloc( op->numInputs * sizeof( double ) );
+	op->coefficientIndices = malloc( op->numCoefficients * sizeof( ITG ) );
+	op->referenceCoefficients = malloc( op->numCoefficients * sizeof( double ) );
+	op->outputOffsets = malloc( numInterfaces * sizeof( ITG ) );
+	op->referenceOutputs = malloc( op->numOutputs * sizeof( double ) );
+	op->referenceKDelta = malloc( op->numOutputs * sizeof( double ) );
+
+	for( i = 0 ; i < numInterfaces ; i++ )
+	{
+		enum xloadVariable inputVariable = ( interfaces[i]->readData == HEAT_FLUX ) ? DFLUX : FILM_T;
+
+		for( k = 0 ; k < interfaces[i]->numElements ; k++ )
+		{
+			op->inputIndices[n] = interfaces[i]->xloadIndices[k] + getXloadIndexOffset( inputVariable );
+			op->inputElements[n] = ( *sim->nelemload )[interfaces[i]->xloadIndices[k]] - 1;
+			op->inputColors[n] = -1;
+			n++;
+
+			if( interfaces[i]->readData == CONVECTION )
+			{
+				op->coefficientIndices[c++] = interfaces[i]->xloadIndices[k] + getXloadIndexOffset( FILM_H );
+			}
+		}
+
+		op->outputOffsets[i] = ( i == 0 ) ? 0 : op->outputOffsets[i - 1]
+							   + ( ( interfaces[i - 1]->writeData == TEMPERATURE ) ? interfaces[i - 1]->numNodes : interfaces[i - 1]->numElements );
+	}
+
+	// Greedy coloring: an input gets the first color that is not used by any node of its element
+	nodeColors = malloc( (ITG) sim->nk * sizeof( ITG ) );
+
+	for( k = 0 ; k < (ITG) sim->nk ; k++ )
+	{
+		nodeColors[k] = -1;
+	}
+
+	while( numColored < op->numInputs )
+	{
+		for( j = 0 ; j < op->numInputs ; j++ )
+		{
+			ITG element = op->inputElements[j];
+			ITG numElementNodes = getElementNumNodes( element, lakon );
+			bool isFree = true;
+
+			if( op->inputColors[j] >= 0 )
+			{
+				continue;
+			}
+
+			for( k = 0 ; k < numElementNodes ; k++ )
+			{
+				if( nodeColors[kon[ipkon[element] + k] - 1] == op->numColors )
+				{
+					isFree = false;
+				}
+			}
+
+			if( isFree )
+			{
+				for( k = 0 ; k < numElementNodes ; k++ )
+				{
+					nodeColors[kon[ipkon[element] + k] - 1] = op->numColors;
+				}
+				op->inputColors[j] = op->numColors;
+				numColored++;
+			}
+		}
+
+		op->numColors++;
+	}
+
+	free( nodeColors );
+
+	printf( "Using the interface response for the repeated coupling iterations of linear increments (%d read values, %d written values, %d load assemblies)\n",
+			(int) op->numInputs, (int) op->numOutputs, (int) op->numColors + 1 );
+}
+
+static void PreciceInterface_EvaluateWriteData( PreciceInterface * interface, SimulationData * sim, double * v, double * values, double * kDelta )
+{
+	int iset = interface->faceSetID + 1; // Adjust index before calling Fortran function
+
+	switch( interface->writeData )
+	{
+	case TEMPERATURE:
+		getNodeTemperatures( interface->nodeIDs, interface->numNodes, v, sim->mt, values );
+		break;
+	case HEAT_FLUX:
+		FORTRAN( getflux, ( sim->co,
+							sim->ntmat_,
+							v,
+							sim->cocon,
+							sim->ncocon,
+							&iset,
+							sim->istartset,
+							sim->iendset,
+							*sim->ipkon,
+							*sim->lakon,
+							*sim->kon,
+							sim->ialset,
+							*sim->ielmat,
+							sim->mi,
+							values
+							)
+				 );
+		break;
+	case CONVECTION:
+		FORTRAN( getkdeltatemp, ( sim->co,
+								  sim->ntmat_,
+								  v,
+								  sim->cocon,
+								  sim->ncocon,
+								  &iset,
+								  sim->istartset,
+								  sim->iendset,
+								  *sim->ipkon,
+								  *sim->lakon,
+								  *sim->kon,
+								  sim->ialset,
+								  *sim->ielmat,
+								  sim->mi,
+								  kDelta,
+								  values
+								  )
+				 );
+		break;
+	}
+}
+
+bool Precice_IsInterfaceOperatorRequired( SimulationData * sim, bool isLinear )
+{
+	InterfaceOperator * op = &sim->interfaceOperator;
+
+	return sim->useInterfaceOperator
+		   && isLinear
+		   && Precice_CoversCouplingWindow( sim )
+		   && !( op->available && op->responseSolverDt == sim->solver_dt );
+}
+
+ITG Precice_BeginInterfaceOperator( SimulationData * sim, double * xloadact )
+{
+	InterfaceOperator * op = &sim->interfaceOperator;
+	double * v;
+	ITG j;
+
+	printf( "Adapter computing the interface response of the increment...\n" );
+	fflush( stdout );
+
+	if( op->response == NULL )
+	{
+		op->response = malloc( op->numOutputs * op->numInputs * sizeof( double ) );
+	}
+
+	for( j = 0 ; j < op->numInputs ; j++ )
+	{
+		op->savedInputs[j] = xloadact[op->inputIndices[j]];
+	}
+
+	// Only the temperatures are set for each column
+	v = getWorkspace( &op->temperatures, sizeof( double ) * sim->mt * (ITG) sim->nk );
+	memset( v, 0, sizeof( double ) * sim->mt * (ITG) sim->nk );
+
+	op->available = false;
+	op->referenceAvailable = false;
+
+	return op->numColors;
+}
+
+void Precice_SetInterfaceOperatorProbe( SimulationData * sim, double * xloadact, ITG color )
+{
+	InterfaceOperator * op = &sim->interfaceOperator;
+	ITG j;
+
+	for( j = 0 ; j < op->numInputs ; j++ )
+	{
+		xloadact[op->inputIndices[j]] = ( op->inputColors[j] == color ) ? 1 : 0;
+	}
+}
+
+void Precice_GetInterfaceOperatorLoad( SimulationData * sim, ITG input, double * probeLoad, ITG * nactdof, ITG neq, double * load )
+{
+	InterfaceOperator * op = &sim->interfaceOperator;
+	ITG element = op->inputElements[input];
+	ITG numElementNodes = getElementNumNodes( element, *sim->lakon );
+	ITG * kon = *sim->kon;
+	ITG * ipkon = *sim->ipkon;
+	ITG k;
+
+	memset( load, 0, neq * sizeof( double ) );
+
+	// The other inputs of the same color do not load the nodes of this element
+	for( k = 0 ; k < numElementNodes ; k++ )
+	{
+		ITG dof = nactdof[( kon[ipkon[element] + k] - 1 ) * sim->mt];
+
+		if( dof > 0 )
+		{
+			load[dof - 1] = probeLoad[dof - 1];
+		}
+	}
+}
+
+void Precice_SetInterfaceOperatorResponse( SimulationData * sim, ITG input, double * x, ITG * nactdof )
+{
+	InterfaceOperator * op = &sim->interfaceOperator;
+	PreciceInterface ** interfaces = sim->preciceInterfaces;
+	double * v = op->temperatures.data;
+	double * column = &op->response[input * op->numOutputs];
+	ITG k;
+	int i;
+
+	for( k = 0 ; k < (ITG) sim->nk ; k++ )
+	{
+		ITG dof = nactdof[k * sim->mt];
+		v[k * sim->mt] = ( dof > 0 ) ? x[dof - 1] : 0;
+	}
+
+	// The written data is linear in the temperatures, except kDelta that does not depend on them
+	for( i = 0 ; i < sim->numPreciceInterfaces ; i++ )
+	{
+		double * kDelta = ( interfaces[i]->writeData == CONVECTION ) ? malloc( interfaces[i]->numElements * sizeof( double ) ) : NULL;
+		PreciceInterface_EvaluateWriteData( interfaces[i], sim, v, &column[op->outputOffsets[i]], kDelta );
+		free( kDelta );
+	}
+}
+
+void Precice_EndInterfaceOperator( SimulationData * sim, double * xloadact )
+{
+	InterfaceOperator * op = &sim->interfaceOperator;
+	ITG j;
+
+	for( j = 0 ; j < op->numInputs ; j++ )
+	{
+		xloadact[op->inputIndices[j]] = op->savedInputs[j];
+	}
+
+	op->available = true;
+	op->responseSolverDt = sim->solver_dt;
+}
+
+void Precice_SetInterfaceOperatorReference( SimulationData * sim, double * xloadact, bool isLinear )
+{
+	InterfaceOperator * op = &sim->interfaceOperator;
+	PreciceInterface ** interfaces = sim->preciceInterfaces;
+	ITG j;
+	int i;
+
+	if( !sim->useInterfaceOperator )
+	{
+		return;
+	}
+
+	op->referenceAvailable = false;
+
+	// The matrix was factorized again, e.g. for a temperature-dependent material: the response is not valid anymore
+	if( !isLinear )
+	{
+		op->available = false;
+		return;
+	}
+
+	if( !op->available || op->responseSolverDt != sim->solver_dt || !Precice_CoversCouplingWindow( sim ) )
+	{
+		return;
+	}
+
+	// The read values must be applied without amplitude, such that a change of xload is the same change of xloadact
+	for( j = 0 ; j < op->numInputs ; j++ )
+	{
+		if( xloadact[op->inputIndices[j]] != sim->xload[op->inputIndices[j]] )
+		{
+			return;
+		}
+	}
+
+	for( j = 0 ; j < op->numInputs ; j++ )
+	{
+		op->referenceInputs[j] = sim->xload[op->inputIndices[j]];
+	}
+
+	for( j = 0 ; j < op->numCoefficients ; j++ )
+	{
+		op->referenceCoefficients[j] = sim->xload[op->coefficientIndices[j]];
+	}
+
+	for( i = 0 ; i < sim->numPreciceInterfaces ; i++ )
+	{
+		PreciceInterface_EvaluateWriteData( interfaces[i], sim, sim->vold, &op->referenceOutputs[op->outputOffsets[i]], &op->referenceKDelta[op->outputOffsets[i]] );
+	}
+
+	op->referenceAvailable = true;
+}
+
+bool Precice_IsInterfaceOperatorApplicable( SimulationData * sim )
+{
+	InterfaceOperator * op = &sim->interfaceOperator;
+	ITG j;
+
+	if( !sim->useInterfaceOperator || !op->available || !op->referenceAvailable || sim->coupling_iteration == 0 )
+	{
+		return false;
+	}
+
+	if( !Precice_CoversCouplingWindow( sim ) || op->responseSolverDt != sim->solver_dt )
+	{
+		return false;
+	}
+
+	for( j = 0 ; j < op->numCoefficients ; j++ )
+	{
+		if( sim->xload[op->coefficientIndices[j]] != op->referenceCoefficients[j] )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void Precice_WriteInterfaceOperatorData( SimulationData * sim )
+{
+
+	printf( "Adapter writing coupling data from the interface response...\n" );
+	fflush( stdout );
+
+	InterfaceOperator * op = &sim->interfaceOperator;
+	PreciceInterface ** interfaces = sim->preciceInterfaces;
+	int numInterfaces = sim->numPreciceInterfaces;
+	ITG j, k;
+	int i;
+
+	if( !precicec_isWriteDataRequired( sim->solver_dt ) )
+	{
+		return;
+	}
+
+	for( i = 0 ; i < numInterfaces ; i++ )
+	{
+		double * values = ( interfaces[i]->writeData == TEMPERATURE ) ? interfaces[i]->nodeData : interfaces[i]->faceCenterData;
+		ITG numValues = ( interfaces[i]->writeData == TEMPERATURE ) ? interfaces[i]->numNodes : interfaces[i]->numElements;
+
+		memcpy( values, &op->referenceOutputs[op->outputOffsets[i]], numValues * sizeof( double ) );
+
+		for( j = 0 ; j < op->numInputs ; j++ )
+		{
+			double change = sim->xload[op->inputIndices[j]] - op->referenceInputs[j];
+			double * column = &op->response[j * op->numOutputs + op->outputOffsets[i]];
+
+			if( change != 0 )
+			{
+				for( k = 0 ; k < numValues ; k++ )
+				{
+					values[k] += column[k] * change;
+				}
+			}
+		}
+
+		switch( interfaces[i]->writeData )
+		{
+		case TEMPERATURE:
+			precicec_writeBlockScalarData( interfaces[i]->temperatureDataID, interfaces[i]->numNodes, interfaces[i]->preciceNodeIDs, values );
+			break;
+		case HEAT_FLUX:
+			precicec_writeBlockScalarData( interfaces[i]->fluxDataID, interfaces[i]->numElements, interfaces[i]->preciceFaceCenterIDs, values );
+			break;
+		case CONVECTION:
+			precicec_writeBlockScalarData( interfaces[i]->kDeltaWriteDataID, interfaces[i]->numElements, interfaces[i]->preciceFaceCenterIDs, &op->referenceKDelta[op->outputOffsets[i]] );
+			precicec_writeBlockScalarData( interfaces[i]->kDeltaTemperatureWriteDataID, interfaces[i]->numElements, interfaces[i]->preciceFaceCenterIDs, values );
+			break;
+		}
+	}
+}
+
+void Precice_SkipIterationCheckpoint( SimulationData * sim )
+{
+	printf( "Adapter keeping the state of the checkpoint (the increment was not solved)...\n" );
+	fflush( stdout );
+
+	sim->coupling_iteration++;
+}
+
 void Precice_FreeData( SimulationData * sim )
 {
 	int i;
 
-	free( sim->coupling_init_v );
+	freeCheckpointData( &sim->coupling_checkpoint );
+
+	free( sim->interfaceOperator.inputIndices );
+	free( sim->interfaceOperator.inputElements );
+	free( sim->interfaceOperator.inputColors );
+	free( sim->interfaceOperator.coefficientIndices );
+	free( sim->interfaceOperator.referenceCoefficients );
+	free( sim->interfaceOperator.outputOffsets );
+	free( sim->interfaceOperator.response );
+	free( sim->interfaceOperator.referenceInputs );
+	free( sim->interfaceOperator.referenceOutputs );
+	free( sim->interfaceOperator.referenceKDelta );
+	free( sim->interfaceOperator.savedInputs );
+	freeWorkspace( &sim->interfaceOperator.temperatures );
+
+	if( sim->coupling_iterate_v != NULL )
+	{
+		free( sim->coupling_iterate_v );
+	}
 
 	for( i = 0 ; i < sim->numPreciceInterfaces ; i++ )
 	{
@@ -305,6 +1195,10 @@ void PreciceInterface_Create( PreciceInterface * interface, SimulationData * sim
 	interface->faceCenterData = NULL;
 	interface->xbounIndices = NULL;
 	interface->xloadIndices = NULL;
+	interface->multiRateReadSum = NULL;
+	interface->multiRateReadWeightedSum = NULL;
+	interface->multiRateWriteData = NULL;
+	interface->multiRatePreviousWriteData = NULL;
 
 	interface->name = config->patchName;
 
@@ -323,6 +1217,30 @@ void PreciceInterface_Create( PreciceInterface * interface, SimulationData * sim
 
 	PreciceInterface_ConfigureHeatTransferData( interface, sim, config );
 
+	PreciceInterface_ConfigureMultiRate( interface, sim );
+
+}
+
+void PreciceInterface_ConfigureMultiRate( PreciceInterface * interface, SimulationData * sim )
+{
+	ITG numReadValues = ( interface->readData == TEMPERATURE ) ? interface->numNodes : interface->numElements;
+	ITG numWriteValues = ( interface->writeData == TEMPERATURE ) ? interface->numNodes : interface->numElements;
+
+	if( sim->multiRateWindows <= 1 )
+	{
+		return;
+	}
+
+	// For CONVECTION, kDelta and the temperatures are stored
+	if( interface->writeData == CONVECTION )
+	{
+		numWriteValues *= 2;
+	}
+
+	interface->multiRateReadSum = calloc( numReadValues, sizeof( double ) );
+	interface->multiRateReadWeightedSum = calloc( numReadValues, sizeof( double ) );
+	interface->multiRateWriteData = calloc( numWriteValues, sizeof( double ) );
+	interface->multiRatePreviousWriteData = calloc( numWriteValues, sizeof( double ) );
 }
 
 void PreciceInterface_ConfigureFaceCentersMesh( PreciceInterface * interface, SimulationData * sim )
@@ -500,4 +1418,9 @@ void PreciceInterface_FreeData( PreciceInterface * preciceInterface )
 	if( preciceInterface->xloadIndices != NULL )
 		free( preciceInterface->xloadIndices );
 
+	free( preciceInterface->multiRateReadSum );
+	free( preciceInterface->multiRateReadWeightedSum );
+	free( preciceInterface->multiRateWriteData );
+	free( preciceInterface->multiRatePreviousWriteData );
+
 }
@@ -65,11 +65,63 @@ typedef struct PreciceInterface {
 	ITG * xloadIndices;
 	ITG * xbounIndices;
 
+	// Multi-rate coupling: time integrals of the read data over the windows of the current increment
+	// (heat flux, temperature or heat transfer coefficient, and heat transfer coefficient times sink temperature)
+	double * multiRateReadSum;
+	double * multiRateReadWeightedSum;
+
+	// Multi-rate coupling: written data of the last two increments (for CONVECTION: kDelta, then temperatures)
+	double * multiRateWriteData;
+	double * multiRatePreviousWriteData;
+
 	enum CouplingDataType readData;
 	enum CouplingDataType writeData;
 
 } PreciceInterface;
 
+/*
+ * InterfaceOperator: Linear response of the data written at the interfaces to the DFLUX and FILM sink
+ * temperature values read at the interfaces, for an increment that covers a whole coupling window of a
+ * linear heat transfer analysis. The columns are computed once per increment size with the factorized matrix.
+ */
+typedef struct InterfaceOperator {
+
+	// Read values (DFLUX or FILM sink temperature of a face) over all interfaces
+	ITG numInputs;
+	ITG * inputIndices;
+	ITG * inputElements;
+	// The elements of the inputs with the same color have no common node, such that their loads can be assembled together
+	ITG * inputColors;
+	ITG numColors;
+
+	// FILM heat transfer coefficients, which are part of the matrix and must not change
+	ITG numCoefficients;
+	ITG * coefficientIndices;
+	double * referenceCoefficients;
+
+	// Written values over all interfaces, starting at outputOffsets[i] for interface i
+	ITG numOutputs;
+	ITG * outputOffsets;
+
+	// Response of the outputs to the inputs (numOutputs x numInputs, column by column)
+	double * response;
+	double responseSolverDt;
+	bool available;
+
+	// Inputs and outputs of the last solved coupling iteration of the window (kDelta does not depend on the temperatures)
+	double * referenceInputs;
+	double * referenceOutputs;
+	double * referenceKDelta;
+	bool referenceAvailable;
+
+	// Values of the inputs in xloadact, while the loads of the columns are assembled
+	double * savedInputs;
+
+	// Temperatures of a column, in the layout of vold
+	Workspace temperatures;
+
+} InterfaceOperator;
+
 /*
  * SimulationData: Structure with all the CalculiX variables
  * that need to be accessed by the adapter in order to do the coupling.
@@ -109,17 +161,63 @@ typedef struct SimulationData {
 	ITG * ncocon;
 	ITG * mi;
 
+	// Heat transfer analysis (only the temperatures are checkpointed, in contiguous form)
+	bool thermalOnly;
+
 	// Interfaces
 	int numPreciceInterfaces;
 	PreciceInterface ** preciceInterfaces;
 
-	// Coupling data
-	double * coupling_init_v;
+	// Iteration checkpoint: complete state at the start of the coupling window, in one contiguous buffer.
+	// The first array is the solution (nk temperatures if thermalOnly, mt * nk values otherwise).
+	CheckpointData coupling_checkpoint;
+	bool coupling_checkpoint_available;
 	double coupling_init_theta;
 	double coupling_init_dtheta;
 	double precice_dt;
 	double solver_dt;
 
+	// Last coupling iterate (solution at the end of the window, same layout as the solution in coupling_checkpoint), used as initial guess for the linear solver
+	double * coupling_iterate_v;
+	double coupling_iterate_theta;
+	bool coupling_iterate_available;
+
+	// Relative change of the read data in the last coupling iteration
+	double coupling_residual;
+
+	// Index of the coupling iteration in the current window (0 in the first iteration)
+	int coupling_iteration;
+
+	// Linear solver for heat transfer
+	int usePCG;
+	double pcgTolerance;
+
+	// Initial guess of the Newton iterations from the last coupling iterate
+	int warmStart;
+
+	// Newton tolerances loosened in the coupling iterations that are far from convergence
+	int inexactCoupling;
+	double inexactCouplingMaxTolerance;
+
+	// Start of the current increment, set when the solver time step is adjusted
+	double coupling_increment_theta;
+
+	// Written data of the repeated coupling iterations of a linear increment from the interface response
+	int useInterfaceOperator;
+	InterfaceOperator interfaceOperator;
+
+	// Multi-rate coupling: one increment for up to multiRateWindows coupling windows (explicit coupling only).
+	// multiRateSolve is false for the windows in which the increment is not solved.
+	int multiRateWindows;
+	int multiRateLinearPrediction;
+	bool multiRateSolve;
+	int multiRateCount;
+	double multiRateTime;
+	double multiRateReadTime;
+	int multiRateWriteCount;
+	double multiRateWriteTheta;
+	double multiRatePreviousWriteTheta;
+
 } SimulationData;
 
 
@@ -183,18 +281,47 @@ void Precice_FulfilledReadCheckpoint();
 void Precice_FulfilledWriteCheckpoint();
 
 /**
- * @brief Reads iteration checkpoint
+ * @brief Returns the number of values stored for the solution in a checkpoint
+ * @param sim: Structure with CalculiX data
+ */
+ITG Precice_GetCheckpointSize( SimulationData * sim );
+
+/**
+ * @brief Stores the solution v in a checkpoint array (only the temperatures in a heat transfer analysis)
+ * @param sim: Structure with CalculiX data
+ * @param v: CalculiX array with the solution
+ * @param checkpoint: array of size Precice_GetCheckpointSize
+ */
+void Precice_SaveSolution( SimulationData * sim, double * v, double * checkpoint );
+
+/**
+ * @brief Starts a new iteration checkpoint, with the solution as first array
+ * @param sim: Structure with CalculiX data
+ * @param v: address of the CalculiX array with the solution at the start of the window (e.g. vini)
+ */
+void Precice_BeginIterationCheckpoint( SimulationData * sim, double ** v );
+
+/**
+ * @brief Adds an array with state of the increment to the iteration checkpoint (e.g. fini or xbounini)
  * @param sim: Structure with CalculiX data
- * @param v: CalculiX array with the temperature values
+ * @param array: address of the CalculiX array
+ * @param count: number of values that are stored
+ * @param stride: distance between two stored values in the array
+ */
+void Precice_AddCheckpointArray( SimulationData * sim, double ** array, ITG count, ITG stride );
+
+/**
+ * @brief Reads iteration checkpoint: restores time, step size and all arrays of the checkpoint
+ * @param sim: Structure with CalculiX data
+ * @param v: CalculiX array with the current solution, kept as last coupling iterate
  */
 void Precice_ReadIterationCheckpoint( SimulationData * sim, double * v );
 
 /**
- * @brief Writes iteration checkpoint
+ * @brief Writes iteration checkpoint: saves time, step size and all arrays of the checkpoint
  * @param sim: Structure with CalculiX data
- * @param v: CalculiX array with the temperature values
  */
-void Precice_WriteIterationCheckpoint( SimulationData * sim, double * v );
+void Precice_WriteIterationCheckpoint( SimulationData * sim );
 
 /**
  * @brief Reads the coupling data for all interfaces
@@ -204,6 +331,14 @@ void Precice_WriteIterationCheckpoint( SimulationData * sim, double * v );
  */
 void Precice_ReadCouplingData( SimulationData * sim );
 
+/**
+ * @brief Marks the elements that carry a DFLUX or FILM load set by the adapter
+ * @param sim
+ * @param isCoupled: array of size ne, initialized with zeros; set to 1 for the marked elements
+ * @return number of marked elements
+ */
+ITG Precice_MarkCoupledLoadElements( SimulationData * sim, ITG * isCoupled );
+
 /**
  * @brief Writes the coupling data of all interfaces
  * @param sim
@@ -212,6 +347,138 @@ void Precice_ReadCouplingData( SimulationData * sim );
  */
 void Precice_WriteCouplingData( SimulationData * sim );
 
+/**
+ * @brief Returns the position of the end of the current increment between the checkpoint (0) and the
+ * last coupling iterate (1), or -1 if there is no previous coupling iteration in the window
+ * @param sim
+ */
+double Precice_GetIterateFraction( SimulationData * sim );
+
+/**
+ * @brief Replaces the predicted temperatures of the free degrees of freedom by the temperatures of the
+ * last coupling iterate (interpolated in time within the window), as initial guess of the Newton iterations.
+ * Nothing is changed if there is no previous coupling iteration in the window.
+ * @param sim
+ * @param nactdof: CalculiX array with the equation number of each degree of freedom
+ * @param v: CalculiX array with the predicted solution
+ */
+void Precice_WarmStartSolution( SimulationData * sim, ITG * nactdof, double * v );
+
+/**
+ * @brief Computes the initial guess for the temperature correction of the first iteration of an increment,
+ * from the temperatures of the last coupling iteration (interpolated in time within the window).
+ * The guess is zero if there is no previous coupling iteration in the window.
+ * @param sim
+ * @param nactdof: CalculiX array with the equation number of each degree of freedom
+ * @param neq: number of equations
+ * @param x: output initial guess, in the equation numbering
+ */
+void Precice_GetIterateCorrection( SimulationData * sim, ITG * nactdof, ITG neq, double * x );
+
+/**
+ * @brief Returns the relative tolerance of the PCG solver: loose while the coupling residual is large,
+ * and down to the configured linear-solver-tolerance as the coupling converges
+ * @param sim
+ */
+double Precice_GetLinearSolverTolerance( SimulationData * sim );
+
+/**
+ * @brief Returns the tolerance that is sufficient for the current coupling iteration: the configured
+ * inexact-coupling-max-tolerance in the first iteration of a window, then proportional to the coupling residual.
+ * Returns 0 (no loosening) if inexact coupling iterations are disabled or if the coupling is explicit.
+ * @param sim
+ */
+double Precice_GetInexactCouplingTolerance( SimulationData * sim );
+
+/**
+ * @brief Returns true if the increment that was just solved covers the whole coupling window, its matrix was
+ * factorized with the same step size in an earlier iteration (linear heat transfer), and there is no interface
+ * response for this step size yet
+ * @param sim
+ * @param isLinear: true if the factorization of the last Newton iteration was reused
+ */
+bool Precice_IsInterfaceOperatorRequired( SimulationData * sim, bool isLinear );
+
+/**
+ * @brief Starts the computation of the interface response: saves the read values in xloadact
+ * @param sim
+ * @param xloadact: CalculiX array with the actual loads
+ * @return number of colors of the inputs, i.e. number of load assemblies (in addition to the one with zero inputs)
+ */
+ITG Precice_BeginInterfaceOperator( SimulationData * sim, double * xloadact );
+
+/**
+ * @brief Sets the read values in xloadact to 1 for the inputs of the given color and to 0 for all others
+ * @param sim
+ * @param xloadact: CalculiX array with the actual loads
+ * @param color: color of the inputs, or -1 to set all inputs to 0
+ */
+void Precice_SetInterfaceOperatorProbe( SimulationData * sim, double * xloadact, ITG color );
+
+/**
+ * @brief Extracts the load of one input from the load assembled for its color
+ * @param sim
+ * @param input: index of the input
+ * @param probeLoad: difference of the loads assembled for the color of the input and for zero inputs
+ * @param nactdof: CalculiX array with the equation number of each degree of freedom
+ * @param neq: number of equations
+ * @param load: output load of the input, in the equation numbering
+ */
+void Precice_GetInterfaceOperatorLoad( SimulationData * sim, ITG input, double * probeLoad, ITG * nactdof, ITG neq, double * load );
+
+/**
+ * @brief Stores the response of the outputs to one input
+ * @param sim
+ * @param input: index of the input
+ * @param x: change of the temperatures for a unit input, in the equation numbering
+ * @param nactdof: CalculiX array with the equation number of each degree of freedom
+ */
+void Precice_SetInterfaceOperatorResponse( SimulationData * sim, ITG input, double * x, ITG * nactdof );
+
+/**
+ * @brief Finishes the computation of the interface response: restores the read values in xloadact
+ * @param sim
+ * @param xloadact: CalculiX array with the actual loads
+ */
+void Precice_EndInterfaceOperator( SimulationData * sim, double * xloadact );
+
+/**
+ * @brief Stores the read values and the written data of the increment that was just solved as reference for the
+ * next coupling iterations of the window. The interface response is dropped if the matrix has changed.
+ * @param sim
+ * @param xloadact: CalculiX array with the actual loads
+ * @param isLinear: true if the factorization of the last Newton iteration was reused
+ */
+void Precice_SetInterfaceOperatorReference( SimulationData * sim, double * xloadact, bool isLinear );
+
+/**
+ * @brief Returns true if the written data of the current coupling iteration can be obtained from the interface
+ * response: the increment repeats the reference increment of the window with the same step size, and only the
+ * DFLUX values and FILM sink temperatures changed
+ * @param sim
+ */
+bool Precice_IsInterfaceOperatorApplicable( SimulationData * sim );
+
+/**
+ * @brief Writes the coupling data of all interfaces from the interface response, without solving the increment
+ * @param sim
+ */
+void Precice_WriteInterfaceOperatorData( SimulationData * sim );
+
+/**
+ * @brief Counts a coupling iteration whose increment was not solved, such that the state of the solver is
+ * still the one restored from the checkpoint
+ * @param sim
+ */
+void Precice_SkipIterationCheckpoint( SimulationData * sim );
+
+/**
+ * @brief Writes the coupling data of all interfaces in a window of a multi-rate coupling in which the increment
+ * is not solved: the data of the last solved increment, or its linear extrapolation from the last two increments
+ * @param sim
+ */
+void Precice_WriteMultiRateData( SimulationData * sim );
+
 /**
  * @brief Frees the memory
  * @param sim
@@ -270,6 +537,13 @@ void PreciceInterface_ConfigureTetraFaces( PreciceInterface * interface, Simulat
  */
 void PreciceInterface_ConfigureHeatTransferData( PreciceInterface * interface, SimulationData * sim, InterfaceConfig * config );
 
+/**
+ * @brief Allocates the time integrals of the read data and the stored written data for multi-rate coupling
+ * @param interface
+ * @param sim
+ */
+void PreciceInterface_ConfigureMultiRate( PreciceInterface * interface, SimulationData * sim );
+
 /**
  * @brief Frees the memory
  * @param preciceInterface
@@ -156,6 +156,48 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 	 emax,enres,enetoll,dampwk=0.,dampwkini,temax,        //MPADD
 	 scal2,*tmp=NULL,energystartstep[4],        //MPADD
 	 sizemaxinc, *adblump=NULL;
+
+  /* Adapter: Variables for reusing the factorization of the thermal matrix */
+  ITG ifactorized=0,neqfactor=0,nzsfactor=0;
+  double *adfactor=NULL,*aufactor=NULL;
+
+  /* Adapter: Variables for assembling only the elements with coupled loads */
+  ITG ipartial=0,iassembled=0,ncoupledel=-1,nforc0=0,*ipkonbase=NULL,
+      *ipkoncoupled=NULL;
+  double timeassembled=0.,dtimeassembled=0.,*adbase=NULL,*aubase=NULL,
+      *adbbase=NULL,*aubbase=NULL,*fextbase=NULL,*fnextbase=NULL,
+      *voldassembled=NULL,*veoldassembled=NULL,*t1assembled=NULL,
+      *xbounassembled=NULL,*adcoupled=NULL,*aucoupled=NULL,*adbcoupled=NULL,
+      *aubcoupled=NULL,*fextcoupled=NULL,*fnextcoupled=NULL;
+
+  /* Adapter: Heat transfer analysis (ithermal may be switched
+     temporarily for uncoupled analyses) and number of elements for which
+     the mechanical fields are allocated */
+  ITG iheattransfer,nemech;
+
+  /* Adapter: Variables for the inexact coupling iterations (reference
+     Newton tolerances for the residual and for the solution correction) */
+  double ranref,canref,etacoupling;
+
+  /* Adapter: Variables for the interface response of a linear heat
+     transfer increment (ireconstruct: the increment is solved with the
+     final coupling data of a window whose written data came from the
+     interface response) */
+  ITG ioperator,ireconstruct=0,ifactorreused=0,noperatorcolors,ncolor,jinput;
+  double *fextop=NULL,*xop=NULL;
+
+  /* Adapter: Variables for the PCG solver for heat transfer */
+  ITG npcg;
+  double *xpcg=NULL;
+
+  /* Adapter: Buffers that are kept over the increments of the coupling
+     loop instead of being allocated and freed in every increment */
+  ITG iworkspacematrix=0;
+  Workspace wsv={NULL,0},wsfn={NULL,0},wsstx={NULL,0},wsinum={NULL,0},
+      wsad={NULL,0},wsau={NULL,0},wsresold={NULL,0},wsadcoupled={NULL,0},
+      wsaucoupled={NULL,0},wsfextcoupled={NULL,0},wsadbcoupled={NULL,0},
+      wsaubcoupled={NULL,0},wsfnextcoupled={NULL,0},wsxpcg={NULL,0},
+      wsfextop={NULL,0},wsxop={NULL,0};
 	 
   // MPADD: initialize enresmin to the tolerance
   enetoll=0.02;
@@ -214,7 +256,8 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 	  .vold = vold,
 	  .cocon = cocon,
 	  .ncocon = ncocon,
-	  .mi = mi
+	  .mi = mi,
+	  .thermalOnly = ( *ithermal == 2 )
   };
   
   /* Adapter: Create the interfaces and initialize the coupling */
@@ -258,6 +301,7 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
   
   qa0=ctrl[20];qau=ctrl[21];ea=ctrl[23];deltmx=ctrl[26];
   i0ref=ctrl[0];irref=ctrl[1];icref=ctrl[3];
+  ranref=ctrl[18];canref=ctrl[19];
 
   sminls=ctrl[28];smaxls=ctrl[29];
   
@@ -321,9 +365,17 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 			 ipkon,lakon,kon,ne));
   SFREE(nodorig);
   
+  /* Adapter: in a heat transfer analysis, the mechanical fields (the
+     material stiffness and the strain and stress states at the
+     integration points) are not used by the thermal elements; they
+     are only allocated for a single element */
+
+  iheattransfer=(*ithermal==2);
+  if(iheattransfer){nemech=1;}else{nemech=*ne;}
+
   /* allocating a field for the stiffness matrix */
   
-  NNEW(xstiff,double,(long long)27*mi[0]**ne);
+  NNEW(xstiff,double,(long long)27*mi[0]*nemech);
   
   /* allocating force fields */
   
@@ -574,9 +626,15 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
       NNEW(aux2,double,neq[1]);
       NNEW(fextini,double,neq[1]);
       NNEW(fnext,double,mt**nk);
-      NNEW(fnextini,double,mt**nk);
       NNEW(veini,double,mt**nk);
-      NNEW(accini,double,mt**nk);
+
+      /* Adapter: the accelerations and the external work are only used
+	 in mechanical analyses */
+
+      if(!iheattransfer){
+	  NNEW(fnextini,double,mt**nk);
+	  NNEW(accini,double,mt**nk);
+      }
       NNEW(adb,double,neq[1]);
       NNEW(aub,double,nzs[1]);
       NNEW(cvini,double,neq[1]);
@@ -590,9 +648,9 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
       }
   }
   if((*nstate_!=0)&&(*mortar==1)) NNEW(xstateini,double,1);
-  NNEW(eei,double,6*mi[0]**ne);
-  NNEW(stiini,double,6*mi[0]**ne);
-  NNEW(emeini,double,6*mi[0]**ne);
+  NNEW(eei,double,6*mi[0]*nemech);
+  NNEW(stiini,double,6*mi[0]*nemech);
+  NNEW(emeini,double,6*mi[0]*nemech);
   if(*nener==1)
       NNEW(enerini,double,mi[0]**ne);
   
@@ -1000,14 +1058,59 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
       memcpy(&sideloadref[0],&sideload[0],sizeof(char)*20**nload);
   }
   
-  /* Adapter: Give preCICE the control of the time stepping */
-  while( Precice_IsCouplingOngoing() ) {
+  /* Adapter: the response of the written data to the read data of the
+     interfaces is computed with the factorized matrix of a linear heat
+     transfer analysis (no contact, radiation, networks, fluids or multiple
+     point constraints) */
+
+  ioperator=(simulationData.useInterfaceOperator)&&(iheattransfer)&&
+      (*nmethod==4)&&(*iexpl<=1)&&(ncont==0)&&(ntr==0)&&(ntg==0)&&(icfd==0)&&
+      (*ithermal==2)&&(*isolver==0)&&(!simulationData.usePCG)&&(*nmpc==0);
+  
+  /* Adapter: Give preCICE the control of the time stepping. After the
+     coupling converged, the last increment may still have to be solved */
+  while( Precice_IsCouplingOngoing() || ireconstruct ) {
       
-      /* Adapter: Adjust solver time step */
-      Precice_AdjustSolverTimestep( &simulationData );
+      /* Adapter: the coupling was already advanced in an increment that
+	 is solved with the final coupling data */
+      if(!ireconstruct){
 
-      /* Adapter read coupling data if available */
-      Precice_ReadCouplingData( &simulationData );
+	  /* Adapter: Adjust solver time step */
+	  Precice_AdjustSolverTimestep( &simulationData );
+
+	  /* Adapter read coupling data if available */
+	  Precice_ReadCouplingData( &simulationData );
+      }
+
+      /* Adapter: multi-rate coupling: the increment spans several coupling
+	 windows. In all but its last window, the read data is only
+	 accumulated, and the data of the last increment is written */
+
+      if(!simulationData.multiRateSolve){
+	  Precice_WriteMultiRateData(&simulationData);
+	  Precice_Advance(&simulationData);
+	  continue;
+      }
+
+      /* Adapter: repeated coupling iteration of a linear heat transfer
+	 increment: the written data is the written data of the solved
+	 iteration plus the response to the change of the read data. The
+	 increment is not solved, the state restored from the checkpoint is
+	 kept. Once the coupling converged, the increment is solved with the
+	 final read data */
+
+      if((ioperator)&&(icutb!=0)&&(!ireconstruct)&&
+	 Precice_IsInterfaceOperatorApplicable(&simulationData)){
+	  Precice_WriteInterfaceOperatorData(&simulationData);
+	  Precice_Advance(&simulationData);
+	  if(Precice_IsReadCheckpointRequired()){
+	      Precice_SkipIterationCheckpoint(&simulationData);
+	      Precice_FulfilledReadCheckpoint();
+	  }else{
+	      ireconstruct=1;
+	  }
+	  continue;
+      }
       
       if(icutb==0){
 	  
@@ -1025,13 +1128,6 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 	  
 	  memcpy(&vini[0],&vold[0],sizeof(double)*mt**nk);
       
-      /* Adapter: Write checkpoint if necessary */
-      if( Precice_IsWriteCheckpointRequired() )
-      {
-	      Precice_WriteIterationCheckpoint( &simulationData, vini );
-	      Precice_FulfilledWriteCheckpoint();
-      }
-      
 	  printf( "Start solving..." );
 	  fflush( stdout );
 	  
@@ -1043,10 +1139,14 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 	      fini[k]=f[k];
 	  }
 	  if(*nmethod==4){
-	      for(k=0;k<mt**nk;++k){
-		  veini[k]=veold[k];
-		  accini[k]=accold[k];
-		  fnextini[k]=fnext[k];
+	      if(!iheattransfer){
+		  for(k=0;k<mt**nk;++k){
+		      veini[k]=veold[k];
+		      accini[k]=accold[k];
+		      fnextini[k]=fnext[k];
+		  }
+	      }else{
+		  memcpy(&veini[0],&veold[0],sizeof(double)*mt**nk);
 	      }
 	      for(k=0;k<neq[1];++k){
 		  fextini[k]=fext[k];
@@ -1078,6 +1178,40 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 		  }
 	      }
 	  }	
+      
+	  /* Adapter: Write checkpoint if necessary, with all initial
+	     values of the increment that are restored by a cutback */
+	  if( Precice_IsWriteCheckpointRequired() )
+	  {
+	      Precice_BeginIterationCheckpoint( &simulationData, &vini );
+	      Precice_AddCheckpointArray( &simulationData, &xbounini, *nboun, 1 );
+	      if((*ithermal==1)||(*ithermal>=3)){
+		  Precice_AddCheckpointArray( &simulationData, &t1ini, *nk, 1 );
+	      }
+	      Precice_AddCheckpointArray( &simulationData, &fini, neq[1], 1 );
+	      if(*nmethod==4){
+		  if(!iheattransfer){
+		      Precice_AddCheckpointArray( &simulationData, &veini, mt**nk, 1 );
+		      Precice_AddCheckpointArray( &simulationData, &accini, mt**nk, 1 );
+		  }else{
+		      Precice_AddCheckpointArray( &simulationData, &veini, *nk, mt );
+		  }
+		  Precice_AddCheckpointArray( &simulationData, &fextini, neq[1], 1 );
+		  Precice_AddCheckpointArray( &simulationData, &cvini, neq[1], 1 );
+	      }
+	      if(*ithermal!=2){
+		  Precice_AddCheckpointArray( &simulationData, &stiini, 6*mi[0]*ne0, 1 );
+		  Precice_AddCheckpointArray( &simulationData, &emeini, 6*mi[0]*ne0, 1 );
+	      }
+	      if(*nener==1){
+		  Precice_AddCheckpointArray( &simulationData, &enerini, mi[0]*ne0, 1 );
+	      }
+	      if((*mortar!=1)&&(*nstate_!=0)){
+		  Precice_AddCheckpointArray( &simulationData, &xstateini, *nstate_*mi[0]*(ne0+*nslavs), 1 );
+	      }
+	      Precice_WriteIterationCheckpoint( &simulationData );
+	      Precice_FulfilledWriteCheckpoint();
+	  }
       }
       
       /* check for max. # of increments */
@@ -1386,8 +1520,8 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
       
       /* invert nactdof */
       
-      SFREE(nactdofinv);
-      NNEW(nactdofinv,ITG,mt**nk);
+      RENEW(nactdofinv,ITG,mt**nk);
+      DMEMSET(nactdofinv,0,mt**nk,0);
       NNEW(nodorig,ITG,*nk);
       FORTRAN(gennactdofinv,(nactdof,nactdofinv,nk,mi,nodorig,
 			     ipkon,lakon,kon,ne));
@@ -1416,13 +1550,21 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
       
       /* prediction of the kinematic vectors  */
       
-      NNEW(v,double,mt**nk);
+      v=getWorkspace(&wsv,sizeof(double)*mt**nk);
       
       prediction(uam,nmethod,&bet,&gam,&dtime,ithermal,nk,veold,accold,v,
 		 &iinc,&idiscon,vold,nactdof,mi);
       
-      NNEW(fn,double,mt**nk);
-      NNEW(stx,double,6*mi[0]**ne);
+      /* Adapter: in a repeated coupling iteration, the Newton iterations
+	 start from the temperatures of the last coupling iterate instead
+	 of the predicted ones */
+      
+      if((simulationData.warmStart)&&(*ithermal>1)){
+	  Precice_WarmStartSolution(&simulationData,nactdof,v);
+      }
+      
+      fn=getWorkspace(&wsfn,sizeof(double)*mt**nk);
+      stx=getWorkspace(&wsstx,sizeof(double)*6*mi[0]**ne);
       
       /* determining the internal forces at the start of the increment
 	 
@@ -1465,7 +1607,7 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 	  iperturb[1]=0;
 	  
 	  for(k=0;k<neq[1];++k){b[k]=f[k];}
-	  NNEW(inum,ITG,*nk);
+	  inum=getWorkspace(&wsinum,sizeof(ITG)**nk);
 	  results(co,nk,kon,ipkon,lakon,ne,v,stn,inum,stx,
 		  elcon,nelcon,rhcon,nrhcon,alcon,nalcon,alzero,ielmat,
 		  ielorien,norien,orab,ntmat_,t1ini,t1act,ithermal,
@@ -1483,7 +1625,7 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 		  sideload,xloadact,xloadold,&icfd,inomat,pslavsurf,pmastsurf,
 		  mortar,islavact,cdn,islavnode,nslavnode,ntie,clearini,
                   islavsurf,ielprop,prop,energyini,energy,&kscale);
-	  iperturb[0]=0;SFREE(inum);
+	  iperturb[0]=0;
 	  
 	  /* check whether any displacements or temperatures are changed
 	     in the new increment */
@@ -1493,7 +1635,7 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
       }
       else{
 	  
-	  NNEW(inum,ITG,*nk);
+	  inum=getWorkspace(&wsinum,sizeof(ITG)**nk);
 	  results(co,nk,kon,ipkon,lakon,ne,v,stn,inum,stx,
 		  elcon,nelcon,rhcon,nrhcon,alcon,nalcon,alzero,ielmat,
 		  ielorien,norien,orab,ntmat_,t0,t1act,ithermal,
@@ -1511,7 +1653,6 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 		  sideload,xloadact,xloadold,&icfd,inomat,pslavsurf,pmastsurf,
 		  mortar,islavact,cdn,islavnode,nslavnode,ntie,clearini,
                   islavsurf,ielprop,prop,energyini,energy,&kscale);
-	  SFREE(inum);
 	  
 	  memcpy(&vold[0],&v[0],sizeof(double)*mt**nk);
 	  
@@ -1526,8 +1667,6 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
       ielas=0;
       iout=0;
       
-      SFREE(fn);SFREE(v);
-      if((*ithermal!=3)||(ncont==0)||(*mortar!=1)||(*ncmat_<11)) SFREE(stx);
       
       /***************************************************************/
       /* iteration counter and start of the loop over the iterations */
@@ -1536,7 +1675,15 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
     iit=1;
     icntrl=0;
     ctrl[0]=i0ref;ctrl[1]=irref;ctrl[3]=icref;
-    if(*nmethod!=4)NNEW(resold,double,neq[1]);
+
+    /* Adapter: the Newton tolerances are loosened while the coupling
+       data of the window still changes significantly */
+    
+    etacoupling=Precice_GetInexactCouplingTolerance(&simulationData);
+    if(ireconstruct) etacoupling=0.;
+    ctrl[18]=(ranref>etacoupling)?ranref:etacoupling;
+    ctrl[19]=(canref>etacoupling)?canref:etacoupling;
+    if(*nmethod!=4)resold=getWorkspace(&wsresold,sizeof(double)*neq[1]);
     if(uncoupled){
 	*ithermal=2;
 	NNEW(iruc,ITG,nzs[1]-nzs[0]);
@@ -1676,21 +1823,21 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 
 	      /* invert nactdof */
 	      
-	      SFREE(nactdofinv);
-	      NNEW(nactdofinv,ITG,mt**nk);
+	      RENEW(nactdofinv,ITG,mt**nk);
+	      DMEMSET(nactdofinv,0,mt**nk,0);
 	      NNEW(nodorig,ITG,*nk);
 	      FORTRAN(gennactdofinv,(nactdof,nactdofinv,nk,mi,nodorig,
 				     ipkon,lakon,kon,ne));
 	      SFREE(nodorig);
 	      
-	      NNEW(v,double,mt**nk);
-	      NNEW(stx,double,6*mi[0]**ne);
-	      NNEW(fn,double,mt**nk);
+	      v=getWorkspace(&wsv,sizeof(double)*mt**nk);
+	      stx=getWorkspace(&wsstx,sizeof(double)*6*mi[0]**ne);
+	      fn=getWorkspace(&wsfn,sizeof(double)*mt**nk);
       
 	      memcpy(&v[0],&vold[0],sizeof(double)*mt**nk);
 	      iout=-1;
 	      
-	      NNEW(inum,ITG,*nk);
+	      inum=getWorkspace(&wsinum,sizeof(ITG)**nk);
 	      results(co,nk,kon,ipkon,lakon,ne,v,stn,inum,stx,
 	        elcon,nelcon,rhcon,nrhcon,alcon,nalcon,alzero,ielmat,
 		ielorien,norien,orab,ntmat_,t0,t1act,ithermal,
@@ -1711,8 +1858,6 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 
 	      /*for(k=0;k<neq[1];++k){printf("f=%" ITGFORMAT ",%f\n",k,f[k]);}*/
 	      
-	      SFREE(v);SFREE(fn);SFREE(inum);
-	      if((*ithermal!=3)||(ncont==0)||(*mortar!=1)||(*ncmat_<11)) SFREE(stx);
 	      iout=0;
 	      
 	  }else{
@@ -1743,18 +1888,167 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 		  ncmat_,ntmat_,kon,islavsurf,pmastsurf,springarea,co,vold,
                   veold,pslavsurf,xloadact,nload,&nload_,nelemload,iamload,
 		  idefload,sideload,stx,nam));
-	  SFREE(idefload);SFREE(stx);
+	  SFREE(idefload);
       }
       
       if(*iexpl<=1){
 
 	/* calculating the local stiffness matrix and external loading */
 
-	NNEW(ad,double,neq[1]);
-	NNEW(au,double,nzs[1]);
+	/* Adapter: the matrix is kept in a workspace, unless the solver
+	   reallocates it */
+
+	iworkspacematrix=(*mortar<=1)&&(*isolver!=2)&&(*isolver!=3)&&(*isolver!=5);
+	if(iworkspacematrix){
+	    ad=getWorkspace(&wsad,sizeof(double)*neq[1]);
+	    au=getWorkspace(&wsau,sizeof(double)*nzs[1]);
+	}else{
+	    NNEW(ad,double,neq[1]);
+	    NNEW(au,double,nzs[1]);
+	}
 
 	if(*nmethod==4) DMEMSET(fnext,0,mt**nk,0.);
 
+	/* Adapter: heat transfer with loads set by the adapter. Only the
+	   elements with coupled DFLUX or FILM loads are assembled in each
+	   iteration. The contributions of the remaining elements are kept
+	   as long as the state they depend on does not change, which is
+	   the case when a coupling iteration restarts from the checkpoint
+	   with the same increment */
+
+	if((*ithermal==2)&&(nasym==0)&&(ncont==0)&&(icascade==0)&&(!uncoupled)){
+	    if(ncoupledel<0){
+		NNEW(ipkoncoupled,ITG,*ne);
+		ncoupledel=Precice_MarkCoupledLoadElements(&simulationData,ipkoncoupled);
+		if(ncoupledel>0){
+		    NNEW(ipkonbase,ITG,*ne);
+		    for(k=0;k<*ne;k++){
+			if(ipkoncoupled[k]==1){
+			    ipkoncoupled[k]=ipkon[k];
+			    ipkonbase[k]=-1;
+			}else{
+			    ipkoncoupled[k]=-1;
+			    ipkonbase[k]=ipkon[k];
+			}
+		    }
+		}else{
+		    SFREE(ipkoncoupled);
+		}
+	    }
+	    ipartial=(ncoupledel>0);
+	}else{
+	    ipartial=0;
+	}
+
+	if(ipartial){
+	    if((iassembled==1)&&(time==timeassembled)&&(dtime==dtimeassembled)&&
+	       (memcmp(vold,voldassembled,sizeof(double)*mt**nk)==0)&&
+	       (memcmp(veold,veoldassembled,sizeof(double)*mt**nk)==0)&&
+	       (memcmp(t1act,t1assembled,sizeof(double)**nk)==0)&&
+	       (memcmp(xbounact,xbounassembled,sizeof(double)**nboun)==0)){
+		printf(" reusing the assembled elements without coupled loads\n\n");
+		memcpy(&ad[0],&adbase[0],sizeof(double)*neq[1]);
+		memcpy(&au[0],&aubase[0],sizeof(double)*nzs[1]);
+		memcpy(&fext[0],&fextbase[0],sizeof(double)*neq[1]);
+		if(*nmethod==4){
+		    memcpy(&adb[0],&adbbase[0],sizeof(double)*neq[1]);
+		    memcpy(&aub[0],&aubbase[0],sizeof(double)*nzs[1]);
+		    memcpy(&fnext[0],&fnextbase[0],sizeof(double)*mt**nk);
+		}
+	    }else{
+		DMEMSET(fext,0,neq[1],0.);
+		if(*nmethod==4){
+		    DMEMSET(adb,0,neq[1],0.);
+		    DMEMSET(aub,0,nzs[1],0.);
+		}
+
+		mafillsmmain(co,nk,kon,ipkonbase,lakon,ne,nodeboun,ndirboun,xbounact,nboun,
+			  ipompc,nodempc,coefmpc,nmpc,nodeforc,ndirforc,xforcact,
+			  nforc,nelemload,sideload,xloadact,nload,xbodyact,ipobody,
+			  nbody,cgr,ad,au,fext,nactdof,icol,jq,irow,neq,nzl,
+			  nmethod,ikmpc,ilmpc,ikboun,ilboun,
+			  elcon,nelcon,rhcon,nrhcon,alcon,nalcon,alzero,
+			  ielmat,ielorien,norien,orab,ntmat_,
+			  t0,t1act,ithermal,prestr,iprestr,vold,iperturb,sti,
+			  nzs,stx,adb,aub,iexpl,plicon,nplicon,plkcon,nplkcon,
+			  xstiff,npmat_,&dtime,matname,mi,
+			  ncmat_,mass,&stiffness,&buckling,&rhsi,&intscheme,
+			  physcon,shcon,nshcon,cocon,ncocon,ttime,&time,istep,&iinc,
+			  &coriolis,ibody,xloadold,&reltime,veold,springarea,nstate_,
+			  xstateini,xstate,thicke,integerglob,doubleglob,
+			  tieset,istartset,iendset,ialset,ntie,&nasym,pslavsurf,
+			  pmastsurf,mortar,clearini,ielprop,prop,&ne0,fnext,&kscale);
+
+		if(iassembled==0){
+		    NNEW(adbase,double,neq[1]);
+		    NNEW(aubase,double,nzs[1]);
+		    NNEW(fextbase,double,neq[1]);
+		    if(*nmethod==4){
+			NNEW(adbbase,double,neq[1]);
+			NNEW(aubbase,double,nzs[1]);
+			NNEW(fnextbase,double,mt**nk);
+		    }
+		    NNEW(voldassembled,double,mt**nk);
+		    NNEW(veoldassembled,double,mt**nk);
+		    NNEW(t1assembled,double,*nk);
+		    NNEW(xbounassembled,double,*nboun);
+		    iassembled=1;
+		}
+		memcpy(&adbase[0],&ad[0],sizeof(double)*neq[1]);
+		memcpy(&aubase[0],&au[0],sizeof(double)*nzs[1]);
+		memcpy(&fextbase[0],&fext[0],sizeof(double)*neq[1]);
+		if(*nmethod==4){
+		    memcpy(&adbbase[0],&adb[0],sizeof(double)*neq[1]);
+		    memcpy(&aubbase[0],&aub[0],sizeof(double)*nzs[1]);
+		    memcpy(&fnextbase[0],&fnext[0],sizeof(double)*mt**nk);
+		}
+		memcpy(&voldassembled[0],&vold[0],sizeof(double)*mt**nk);
+		memcpy(&veoldassembled[0],&veold[0],sizeof(double)*mt**nk);
+		memcpy(&t1assembled[0],&t1act[0],sizeof(double)**nk);
+		memcpy(&xbounassembled[0],&xbounact[0],sizeof(double)**nboun);
+		timeassembled=time;
+		dtimeassembled=dtime;
+	    }
+
+	    /* the point loads are part of the kept contributions */
+
+	    adcoupled=getWorkspace(&wsadcoupled,sizeof(double)*neq[1]);
+	    aucoupled=getWorkspace(&wsaucoupled,sizeof(double)*nzs[1]);
+	    fextcoupled=getWorkspace(&wsfextcoupled,sizeof(double)*neq[1]);
+	    if(*nmethod==4){
+		adbcoupled=getWorkspace(&wsadbcoupled,sizeof(double)*neq[1]);
+		aubcoupled=getWorkspace(&wsaubcoupled,sizeof(double)*nzs[1]);
+		fnextcoupled=getWorkspace(&wsfnextcoupled,sizeof(double)*mt**nk);
+	    }
+
+	    mafillsmmain(co,nk,kon,ipkoncoupled,lakon,ne,nodeboun,ndirboun,xbounact,nboun,
+		      ipompc,nodempc,coefmpc,nmpc,nodeforc,ndirforc,xforcact,
+		      &nforc0,nelemload,sideload,xloadact,nload,xbodyact,ipobody,
+		      nbody,cgr,adcoupled,aucoupled,fextcoupled,nactdof,icol,jq,irow,neq,nzl,
+		      nmethod,ikmpc,ilmpc,ikboun,ilboun,
+		      elcon,nelcon,rhcon,nrhcon,alcon,nalcon,alzero,
+		      ielmat,ielorien,norien,orab,ntmat_,
+		      t0,t1act,ithermal,prestr,iprestr,vold,iperturb,sti,
+		      nzs,stx,adbcoupled,aubcoupled,iexpl,plicon,nplicon,plkcon,nplkcon,
+		      xstiff,npmat_,&dtime,matname,mi,
+		      ncmat_,mass,&stiffness,&buckling,&rhsi,&intscheme,
+		      physcon,shcon,nshcon,cocon,ncocon,ttime,&time,istep,&iinc,
+		      &coriolis,ibody,xloadold,&reltime,veold,springarea,nstate_,
+		      xstateini,xstate,thicke,integerglob,doubleglob,
+		      tieset,istartset,iendset,ialset,ntie,&nasym,pslavsurf,
+		      pmastsurf,mortar,clearini,ielprop,prop,&ne0,fnextcoupled,&kscale);
+
+	    for(k=0;k<neq[1];++k){
+		ad[k]+=adcoupled[k];
+		fext[k]+=fextcoupled[k];
+	    }
+	    for(k=0;k<nzs[1];++k){au[k]+=aucoupled[k];}
+	    if(*nmethod==4){
+		for(k=0;k<neq[1];++k){adb[k]+=adbcoupled[k];}
+		for(k=0;k<nzs[1];++k){aub[k]+=aubcoupled[k];}
+		for(k=0;k<mt**nk;++k){fnext[k]+=fnextcoupled[k];}
+	    }
+	}else{
 	mafillsmmain(co,nk,kon,ipkon,lakon,ne,nodeboun,ndirboun,xbounact,nboun,
 		  ipompc,nodempc,coefmpc,nmpc,nodeforc,ndirforc,xforcact,
 		  nforc,nelemload,sideload,xloadact,nload,xbodyact,ipobody,
@@ -1771,9 +2065,14 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
                   xstateini,xstate,thicke,integerglob,doubleglob,
 		  tieset,istartset,iendset,ialset,ntie,&nasym,pslavsurf,
 		  pmastsurf,mortar,clearini,ielprop,prop,&ne0,fnext,&kscale);
+	}
 
 	if(nasym==1){
-	    RENEW(au,double,2*nzs[1]);
+	    if(iworkspacematrix){
+		au=resizeWorkspace(&wsau,sizeof(double)*2*nzs[1]);
+	    }else{
+		RENEW(au,double,2*nzs[1]);
+	    }
 	    if(*nmethod==4) RENEW(aub,double,2*nzs[1]);
 	    symmetryflag=2;
 	    inputformat=1;
@@ -1885,7 +2184,7 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 	  
 	  *nmethod=0;
 	  ++*kode;
-	  NNEW(inum,ITG,*nk);for(k=0;k<*nk;k++) inum[k]=1;
+	  inum=getWorkspace(&wsinum,sizeof(ITG)**nk);for(k=0;k<*nk;k++) inum[k]=1;
 	  if(strcmp1(&filab[1044],"ZZS")==0){
 	      NNEW(neigh,ITG,40**ne);
 	      NNEW(ipneigh,ITG,*nk);
@@ -1904,7 +2203,7 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
      #ifdef COMPANY
 	  FORTRAN(uout,(v,mi,ithermal,filab));
 #endif
-	  SFREE(inum);FORTRAN(stop,());
+	  FORTRAN(stop,());
 	  
       }
       
@@ -1974,7 +2273,27 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 	      }
 	  }
 	  
-	  if(*isolver==0){
+	  if((simulationData.usePCG)&&(*ithermal==2)&&(nasym==0)&&(!uncoupled)){
+
+	      /* Adapter: heat transfer with the PCG solver. In the first
+		 iteration of an increment, the solution is seeded with the
+		 temperatures of the last coupling iteration, and the
+		 tolerance follows the change of the coupling data */
+
+	      xpcg=getWorkspace(&wsxpcg,sizeof(double)*neq[1]);
+	      if(iit==1){
+		  Precice_GetIterateCorrection(&simulationData,nactdof,neq[1],xpcg);
+	      }
+	      npcg=solvePCG(ad,au,jq,irow,neq[1],b,xpcg,
+			    Precice_GetLinearSolverTolerance(&simulationData),neq[1]);
+	      if(npcg<0){
+		  printf(" *WARNING in nonlingeo: the PCG solver did not converge\n\n");
+	      }else{
+		  printf(" PCG solver converged in %" ITGFORMAT " iterations\n\n",npcg);
+	      }
+	      memcpy(&b[0],&xpcg[0],sizeof(double)*neq[1]);
+	  }
+	  else if(*isolver==0){
 #ifdef SPOOLES
 	      if(*ithermal<2){
 		  spooles(ad,au,adb,aub,&sigma,b,icol,irow,&neq[0],&nzs[0],
@@ -1985,6 +2304,36 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 		  spooles(&ad[neq[0]],&au[nzs[0]],&adb[neq[0]],&aub[nzs[0]],
 			  &sigma,&b[neq[0]],&icol[neq[0]],iruc,
 			  &n1,&n2,&symmetryflag,&inputformat,&nzs[2]);
+	      }else if((*ithermal==2)&&(nasym==0)&&(ncont==0)&&(icascade==0)){
+
+		  /* Adapter: heat transfer. The factorization is kept as long
+		     as the assembled matrix does not change, which is the case
+		     for linear heat transfer with a fixed increment size: only
+		     the right-hand side changes between the Newton iterations
+		     and between the coupling iterations */
+
+		  if((ifactorized==1)&&(neqfactor==neq[1])&&(nzsfactor==nzs[1])&&
+		     (memcmp(ad,adfactor,sizeof(double)*neq[1])==0)&&
+		     (memcmp(au,aufactor,sizeof(double)*nzs[1])==0)){
+		      printf(" reusing the factorized matrix\n\n");
+		      ifactorreused=1;
+		  }else{
+		      ifactorreused=0;
+		      if(ifactorized==1){
+			  spooles_cleanup();
+			  SFREE(adfactor);SFREE(aufactor);
+		      }
+		      neqfactor=neq[1];
+		      nzsfactor=nzs[1];
+		      NNEW(adfactor,double,neqfactor);
+		      NNEW(aufactor,double,nzsfactor);
+		      memcpy(&adfactor[0],&ad[0],sizeof(double)*neqfactor);
+		      memcpy(&aufactor[0],&au[0],sizeof(double)*nzsfactor);
+		      spooles_factor(ad,au,adb,aub,&sigma,icol,irow,&neq[1],&nzs[1],
+				     &symmetryflag,&inputformat,&nzs[2]);
+		      ifactorized=1;
+		  }
+		  spooles_solve(b,&neq[1]);
 	      }else{
 		  spooles(ad,au,adb,aub,&sigma,b,icol,irow,&neq[1],&nzs[1],
 			  &symmetryflag,&inputformat,&nzs[2]);
@@ -2058,7 +2407,7 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 	  }
 	  
 //	  if((*mortar<=1)&&((*nmethod!=4)||(*iexpl>1)){SFREE(ad);SFREE(au);}    //MPADD 
-	  if(*mortar<=1){SFREE(ad);SFREE(au);} 
+	  if((*mortar<=1)&&(!iworkspacematrix)){SFREE(ad);SFREE(au);} 
       }
       
       /* explicit dynamic step */
@@ -2078,13 +2427,13 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 
       /* calculating the displacements, stresses and forces */
       
-      NNEW(v,double,mt**nk);
+      v=getWorkspace(&wsv,sizeof(double)*mt**nk);
       memcpy(&v[0],&vold[0],sizeof(double)*mt**nk);
       
-      NNEW(stx,double,6*mi[0]**ne);
-      NNEW(fn,double,mt**nk);
+      stx=getWorkspace(&wsstx,sizeof(double)*6*mi[0]**ne);
+      fn=getWorkspace(&wsfn,sizeof(double)*mt**nk);
       
-      NNEW(inum,ITG,*nk);
+      inum=getWorkspace(&wsinum,sizeof(ITG)**nk);
       results(co,nk,kon,ipkon,lakon,ne,v,stn,inum,stx,
 	      elcon,nelcon,rhcon,nrhcon,alcon,nalcon,alzero,ielmat,
 	      ielorien,norien,orab,ntmat_,t0,t1act,ithermal,
@@ -2102,7 +2451,6 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 	      sideload,xloadact,xloadold,&icfd,inomat,pslavsurf,pmastsurf,
 	      mortar,islavact,cdn,islavnode,nslavnode,ntie,clearini,
               islavsurf,ielprop,prop,energyini,energy,&kscale);
-      SFREE(inum);
 
       /* implicit dynamics (Matteo Pacher) */
 
@@ -2146,7 +2494,6 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 
       if((*mortar==1)&&(iit!=1)&&(*ne-ne0>0)&&(*nmethod!=4)){
 
-	  SFREE(v);SFREE(stx);SFREE(fn);
       
 	  /* calculating the residual */
       
@@ -2181,13 +2528,13 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 
 	  for(i=0;i<neq[1];i++){b[i]*=flinesearch;}
       
-	  NNEW(v,double,mt**nk);
+	  v=getWorkspace(&wsv,sizeof(double)*mt**nk);
 	  memcpy(&v[0],&vold[0],sizeof(double)*mt**nk);
 	  
-	  NNEW(stx,double,6*mi[0]**ne);
-	  NNEW(fn,double,mt**nk);
+	  stx=getWorkspace(&wsstx,sizeof(double)*6*mi[0]**ne);
+	  fn=getWorkspace(&wsfn,sizeof(double)*mt**nk);
 	  
-	  NNEW(inum,ITG,*nk);
+	  inum=getWorkspace(&wsinum,sizeof(ITG)**nk);
 	  results(co,nk,kon,ipkon,lakon,ne,v,stn,inum,stx,
 	      elcon,nelcon,rhcon,nrhcon,alcon,nalcon,alzero,ielmat,
 	      ielorien,norien,orab,ntmat_,t0,t1act,ithermal,
@@ -2205,7 +2552,6 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 	      sideload,xloadact,xloadold,&icfd,inomat,pslavsurf,pmastsurf,
 	      mortar,islavact,cdn,islavnode,nslavnode,ntie,clearini,
 		  islavsurf,ielprop,prop,energyini,energy,&kscale);
-	  SFREE(inum);
       }
       
       /* calculating the residual */
@@ -2230,7 +2576,6 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 	  FORTRAN(negativepressure,(&ne0,ne,mi,stx,&pressureratio));
       }else{pressureratio=0.;}
 
-      SFREE(v);SFREE(stx);SFREE(fn);
 
       if(idamping==1){SFREE(adc);SFREE(auc);}
 
@@ -2395,7 +2740,6 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
       
     }
 
-    if(*nmethod!=4)SFREE(resold);
 
     /*********************************************************/
     /*   end of the iteration loop                          */
@@ -2406,14 +2750,84 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
                 another increment size (dtheta) */
     
     /* Adapter: Perform coupling related actions, only if solver iterations converged (icutb == 0) */
-    if( icutb == 0 )
+    if( ( icutb == 0 ) && ( ireconstruct ) )
+    {
+	    /* Adapter: the coupling data of this increment was already written
+	       from the interface response, and the coupling was advanced */
+	    ireconstruct = 0;
+    }
+    else if( icutb == 0 )
     {
+#ifdef SPOOLES
+	    /* Adapter: linear heat transfer. The response of the written data
+	       to each read value is computed once per increment size, with the
+	       loads of the coupled elements and the kept factorization. The
+	       loads of the read values of one color are assembled together,
+	       since their elements have no common node */
+
+	    if((ioperator)&&(ipartial)&&(ifactorized==1)&&
+	       Precice_IsInterfaceOperatorRequired(&simulationData,ifactorreused)){
+		noperatorcolors=Precice_BeginInterfaceOperator(&simulationData,xloadact);
+		fextop=getWorkspace(&wsfextop,sizeof(double)*neq[1]);
+		xop=getWorkspace(&wsxop,sizeof(double)*neq[1]);
+		adcoupled=getWorkspace(&wsadcoupled,sizeof(double)*neq[1]);
+		aucoupled=getWorkspace(&wsaucoupled,sizeof(double)*nzs[1]);
+		fextcoupled=getWorkspace(&wsfextcoupled,sizeof(double)*neq[1]);
+		adbcoupled=getWorkspace(&wsadbcoupled,sizeof(double)*neq[1]);
+		aubcoupled=getWorkspace(&wsaubcoupled,sizeof(double)*nzs[1]);
+		fnextcoupled=getWorkspace(&wsfnextcoupled,sizeof(double)*mt**nk);
+
+		/* the first assembly (ncolor=-1) is done with all read values
+		   set to zero */
+
+		for(ncolor=-1;ncolor<noperatorcolors;ncolor++){
+		    Precice_SetInterfaceOperatorProbe(&simulationData,xloadact,ncolor);
+		    mafillsmmain(co,nk,kon,ipkoncoupled,lakon,ne,nodeboun,ndirboun,xbounact,nboun,
+			      ipompc,nodempc,coefmpc,nmpc,nodeforc,ndirforc,xforcact,
+			      &nforc0,nelemload,sideload,xloadact,nload,xbodyact,ipobody,
+			      nbody,cgr,adcoupled,aucoupled,fextcoupled,nactdof,icol,jq,irow,neq,nzl,
+			      nmethod,ikmpc,ilmpc,ikboun,ilboun,
+			      elcon,nelcon,rhcon,nrhcon,alcon,nalcon,alzero,
+			      ielmat,ielorien,norien,orab,ntmat_,
+			      t0,t1act,ithermal,prestr,iprestr,vold,iperturb,sti,
+			      nzs,stx,adbcoupled,aubcoupled,iexpl,plicon,nplicon,plkcon,nplkcon,
+			      xstiff,npmat_,&dtime,matname,mi,
+			      ncmat_,mass,&stiffness,&buckling,&rhsi,&intscheme,
+			      physcon,shcon,nshcon,cocon,ncocon,ttime,&time,istep,&iinc,
+			      &coriolis,ibody,xloadold,&reltime,veold,springarea,nstate_,
+			      xstateini,xstate,thicke,integerglob,doubleglob,
+			      tieset,istartset,iendset,ialset,ntie,&nasym,pslavsurf,
+			      pmastsurf,mortar,clearini,ielprop,prop,&ne0,fnextcoupled,&kscale);
+		    if(ncolor<0){
+			memcpy(&fextop[0],&fextcoupled[0],sizeof(double)*neq[1]);
+			continue;
+		    }
+		    for(k=0;k<neq[1];++k){fextcoupled[k]-=fextop[k];}
+		    for(jinput=0;jinput<simulationData.interfaceOperator.numInputs;jinput++){
+			if(simulationData.interfaceOperator.inputColors[jinput]!=ncolor) continue;
+			Precice_GetInterfaceOperatorLoad(&simulationData,jinput,fextcoupled,nactdof,neq[1],xop);
+			spooles_solve(xop,&neq[1]);
+			Precice_SetInterfaceOperatorResponse(&simulationData,jinput,xop,nactdof);
+		    }
+		}
+		Precice_EndInterfaceOperator(&simulationData,xloadact);
+	    }
+#endif
+
+	    /* Adapter: the solved increment is the reference for the next
+	       coupling iterations of the window */
+	    if(ioperator){
+		Precice_SetInterfaceOperatorReference(&simulationData,xloadact,ifactorreused);
+	    }
+
 	    /* Adapter: Write coupling data */
 	    Precice_WriteCouplingData( &simulationData );
 	    /* Adapter: Advance the coupling */
 	    Precice_Advance( &simulationData );
 
-	    /* Adapter: If the coupling does not converge, read the checkpoint */
+	    /* Adapter: If the coupling does not converge, read the checkpoint
+	       into the initial values of the increment, which are copied back
+	       like for a cutback (icutb!=0) */
 	    if( Precice_IsReadCheckpointRequired() )
 	    {
 		    if( *nmethod == 4 )
@@ -2490,9 +2904,13 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 	  f[k]=fini[k];
       }
       if(*nmethod==4){
-	for(k=0;k<mt**nk;++k){
-	  veold[k]=veini[k];
-	  accold[k]=accini[k];
+	if(!iheattransfer){
+	  for(k=0;k<mt**nk;++k){
+	    veold[k]=veini[k];
+	    accold[k]=accini[k];
+	  }
+	}else{
+	  memcpy(&veold[0],&veini[0],sizeof(double)*mt**nk);
 	}
 	for(k=0;k<neq[1];++k){
 //	  f[k]=fini[k];
@@ -2566,12 +2984,12 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
       /* calculating the displacements and the stresses and storing */
       /* the results in frd format  */
 	
-      NNEW(v,double,mt**nk);
-      NNEW(fn,double,mt**nk);
+      v=getWorkspace(&wsv,sizeof(double)*mt**nk);
+      fn=getWorkspace(&wsfn,sizeof(double)*mt**nk);
       NNEW(stn,double,6**nk);
       if(*ithermal>1) NNEW(qfn,double,3**nk);
-      NNEW(inum,ITG,*nk);
-      NNEW(stx,double,6*mi[0]**ne);
+      inum=getWorkspace(&wsinum,sizeof(ITG)**nk);
+      stx=getWorkspace(&wsstx,sizeof(double)*6*mi[0]**ne);
       
       if(strcmp1(&filab[261],"E   ")==0) NNEW(een,double,6**nk);
       if(strcmp1(&filab[435],"PEEQ")==0) NNEW(epn,double,*nk);
@@ -2647,7 +3065,7 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 #endif
       }
       
-      SFREE(v);SFREE(fn);SFREE(stn);SFREE(inum);SFREE(stx);
+      SFREE(stn);
       if(*ithermal>1){SFREE(qfn);}
       
       if(strcmp1(&filab[261],"E   ")==0) SFREE(een);
@@ -2664,6 +3082,15 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
   /*   end of the increment loop                          */
   /*********************************************************/
 
+  /* Adapter: Free the buffers of the coupling loop */
+  freeWorkspace(&wsv);freeWorkspace(&wsfn);freeWorkspace(&wsstx);
+  freeWorkspace(&wsinum);freeWorkspace(&wsad);freeWorkspace(&wsau);
+  freeWorkspace(&wsresold);freeWorkspace(&wsadcoupled);
+  freeWorkspace(&wsaucoupled);freeWorkspace(&wsfextcoupled);
+  freeWorkspace(&wsadbcoupled);freeWorkspace(&wsaubcoupled);
+  freeWorkspace(&wsfnextcoupled);freeWorkspace(&wsxpcg);
+  freeWorkspace(&wsfextop);freeWorkspace(&wsxop);
+
   if(jprint!=0){
 
   /* calculating the displacements and the stresses and storing  
@@ -2855,9 +3282,9 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
 
   SFREE(fini);
   if(*nmethod==4){
-    SFREE(aux2);SFREE(fextini);SFREE(veini);SFREE(accini);
+    SFREE(aux2);SFREE(fextini);SFREE(veini);
     SFREE(adb);SFREE(aub);SFREE(cvini);SFREE(cv);SFREE(fnext);
-    SFREE(fnextini);
+    if(!iheattransfer){SFREE(fnextini);SFREE(accini);}
   }
   SFREE(eei);SFREE(stiini);SFREE(emeini);
   if(*nener==1)SFREE(enerini);
@@ -2931,7 +3358,29 @@ void nonlingeo_precice(double **cop, ITG *nk, ITG **konp, ITG **ipkonp, char **l
   
   (*ttime)+=(*tper);
   
+  /* Adapter: restore the Newton tolerances of the input deck, which
+     are the reference of the next step */
+  
+  ctrl[18]=ranref;ctrl[19]=canref;
+  
   /* Adapter: Free the memory */
+#ifdef SPOOLES
+  /* Adapter: Free the kept factorization of the thermal matrix */
+  if(ifactorized==1){
+      spooles_cleanup();
+      SFREE(adfactor);SFREE(aufactor);
+  }
+#endif
+
+  /* Adapter: Free the kept assembly of the elements without coupled loads */
+  if(ncoupledel>0){SFREE(ipkonbase);SFREE(ipkoncoupled);}
+  if(iassembled==1){
+      SFREE(adbase);SFREE(aubase);SFREE(fextbase);
+      if(*nmethod==4){SFREE(adbbase);SFREE(aubbase);SFREE(fnextbase);}
+      SFREE(voldassembled);SFREE(veoldassembled);SFREE(t1assembled);
+      SFREE(xbounassembled);
+  }
+
   Precice_FreeData( &simulationData );
   Precice_Finalize();
   
@@ -2,13 +2,16 @@
 #define ADAPTER_H
 
 #include <mpi.h>
+#include <algorithm>
 #include <string>
 #include <vector>
+#include <functional>
 #include <boost/log/trivial.hpp>
 #include <boost/log/expressions.hpp>
 #include "fvCFD.H"
 #include "precice/SolverInterface.hpp"
 #include "Interface.h"
+#include "AsyncFieldWriter.h"
 
 namespace adapter
 {
@@ -49,6 +52,93 @@ protected:
 	bool _checkpointingIsEnabled = true;
 	bool _subcyclingEnabled = false;
 
+	/**
+	 * @brief Order of the interpolation of the read data in time for subcycling (0: constant, 1: linear, 2: quadratic)
+	 */
+	int _timeInterpolationOrder;
+
+	/**
+	 * @brief Order of the extrapolation of the read data for the first iteration of a coupling window (0: none, 1: linear, 2: quadratic)
+	 */
+	int _extrapolationOrder;
+
+	/**
+	 * @brief Number of iterations of a steady-state solver between two couplings, its upper bound,
+	 * and the relative change of the interface data below which the interface is stationary
+	 */
+	int _steadyCouplingInterval;
+	int _steadyCouplingMaxInterval;
+	double _steadyCouplingTolerance;
+
+	/**
+	 * @brief Number of steady-state iterations until the next coupling (0 if the current iteration is coupled)
+	 */
+	int _iterationsUntilCoupling = 0;
+
+	/**
+	 * @brief Number of completed couplings of the steady-state solver
+	 */
+	int _numSteadyCouplings = 0;
+
+	/**
+	 * @brief True once the interface data did not change by more than the tolerance between two couplings
+	 */
+	bool _isInterfaceStationary = false;
+
+	/**
+	 * @brief Returns the largest initial residual of the linear solvers in the current iteration of the solver
+	 */
+	scalar _maxInitialResidual();
+
+	/**
+	 * @brief True if this participant is the second participant of a serial coupling scheme, such that the data
+	 * received in a new window already belongs to the end of that window
+	 */
+	bool _isReadDataOfCurrentWindow;
+
+	/**
+	 * @brief Returns true if the participant is the second participant of a serial coupling scheme in the preCICE configuration
+	 */
+	bool _isSecondParticipantOfSerialScheme( std::string participantName, std::string preciceConfigFilename );
+
+	/**
+	 * @brief Returns the largest limit of the relative convergence measures in the preCICE configuration (-1 if there is none)
+	 */
+	double _getRelativeConvergenceLimit( std::string preciceConfigFilename );
+
+	/**
+	 * @brief Whether the written data is averaged in time over the (sub)steps of the coupling window
+	 */
+	bool _windowAveragedWriteData;
+
+	/**
+	 * @brief Whether the coupling window is divided into substeps of equal size when subcycling
+	 */
+	bool _evenSubsteps;
+
+	/**
+	 * @brief Number of substeps and substep size of the current coupling window, kept when the window is repeated
+	 */
+	int _evenSubstepCount = 0;
+	double _evenSubstepTimeStep = 0;
+
+	/**
+	 * @brief Returns the size of the next substep, such that the remaining part of the coupling window is divided
+	 * into equal substeps that are not larger than the given maximum time step
+	 */
+	double _evenSubstepSize( double maxTimeStep );
+
+	/**
+	 * @brief Time at the start of the current coupling window
+	 */
+	double _windowStartTime;
+
+	/**
+	 * @brief Size of the current and of the previous coupling window
+	 */
+	double _windowSize;
+	double _previousWindowSize;
+
     /**
      * @brief Checkpointed time
      */
@@ -65,6 +155,94 @@ protected:
 	std::vector<surfaceScalarField*> _surfaceScalarFields;
 	std::vector<surfaceScalarField*> _surfaceScalarFieldCopies;
 
+	/**
+	 * @brief Callbacks that recompute the derived fields from the restored fields, instead of storing a copy
+	 */
+	std::vector< std::function<void()> > _recomputeCallbacks;
+
+	/**
+	 * @brief Names of the checkpointed fields that are warm-started (from the YAML config file)
+	 */
+	std::vector<std::string> _warmStartFieldNames;
+
+	/**
+	 * @brief Warm-started fields and their last coupling iterate, which is kept when the checkpoint is read
+	 */
+	std::vector<volScalarField*> _warmStartVolScalarFields;
+	std::vector<volScalarField*> _warmStartVolScalarFieldIterates;
+	std::vector<volVectorField*> _warmStartVolVectorFields;
+	std::vector<volVectorField*> _warmStartVolVectorFieldIterates;
+
+	/**
+	 * @brief True if the iterates were stored by the last readCheckpoint and are not applied yet.
+	 * With subcycling, only the first time step of the repeated window starts from them
+	 */
+	bool _warmStartIterateAvailable = false;
+
+	/**
+	 * @brief Returns true if the field is selected for warm start in the YAML config file
+	 */
+	bool _isWarmStartField( std::string fieldName );
+
+	/**
+	 * @brief Index of the coupling iteration in the current window (0 in the first iteration)
+	 */
+	int _couplingIteration = 0;
+
+	/**
+	 * @brief Relative change of the read data in the current coupling iteration, over all interfaces and ranks
+	 * (1 if unknown, e.g. in the first iteration of a window)
+	 */
+	double _couplingResidual = 1;
+
+	/**
+	 * @brief True once a checkpoint has been written, i.e. if the coupling is implicit
+	 */
+	bool _isImplicitCoupling = false;
+
+	/**
+	 * @brief Whether the solver controls are loosened in coupling iterations far from convergence,
+	 * and the loosest relative tolerance of the linear solvers
+	 */
+	bool _inexactCoupling;
+	double _inexactCouplingMaxTolerance;
+
+	/**
+	 * @brief Number of coupling iterations of a window that may be solved with loosened controls
+	 */
+	int _inexactCouplingIterations;
+
+	/**
+	 * @brief Largest relative convergence limit of preCICE (-1 if there is none). Below 100 times this limit,
+	 * the relative change of the read data is small enough to use the original solver controls
+	 */
+	double _couplingConvergenceLimit;
+
+	/**
+	 * @brief Original controls of fvSolution: relTol of each solver and nOuterCorrectors of PIMPLE (-1 if not set)
+	 */
+	bool _solverControlsStored = false;
+	std::vector<scalar> _originalRelTols;
+	label _originalOuterCorrectors = -1;
+
+	/**
+	 * @brief Whether the fields are only written at the end of a coupling window, and whether they are written
+	 * on a background thread
+	 */
+	bool _alignedOutput;
+	bool _asynchronousOutput;
+
+	/**
+	 * @brief True if a write time of the controlDict has been reached in the current coupling window.
+	 * It is kept when a checkpoint is read, and only cleared when the fields are written after the window has converged
+	 */
+	bool _isOutputPending = false;
+
+	/**
+	 * @brief Writer of the fields on a background thread, only used for asynchronous output
+	 */
+	AsyncFieldWriter * _asyncFieldWriter = NULL;
+
 	/**
 	 * @brief Makes a copy of the Foam::Time object
 	 */
@@ -90,6 +268,11 @@ protected:
 	 */
 	int _getMPISize();
 
+	/**
+	 * @brief Gathers the number of interface faces owned by each rank and reports the load balance
+	 */
+	void _reportInterfaceLoadBalance();
+
 public:
 
 	/**
@@ -120,9 +303,11 @@ public:
 	 * @brief Creates a new interface to be handled by preCICE
 	 * @param meshName: Name of the surface mesh as specified in precice-config.xml
 	 * @param patchNames: Names of the patches that are part of this interface, as specified in the OpenFOAM case
+	 * @param locationsType: Locations at which the coupling data is exchanged (face centers by default)
 	 * @return Reference to the created interface
 	 */
-	Interface & addNewInterface( std::string meshName, std::vector<std::string> patchNames );
+	Interface & addNewInterface( std::string meshName, std::vector<std::string> patchNames,
+								 Interface::LocationsType locationsType = Interface::faceCenters );
 
 	/**
 	 * @brief initialize
@@ -130,12 +315,15 @@ public:
 	void initialize();
 
 	/**
-	 * @brief Receives the coupling data by calling precice::readBlockScalarData for each interface
+	 * @brief Receives the coupling data by calling precice::readBlockScalarData for each interface.
+	 * If time interpolation is enabled, the boundary values are interpolated in time for each substep
 	 */
 	void readCouplingData();
 
 	/**
-	 * @brief Sends the coupling data by calling precice::writeBlockScalarData for each interface
+	 * @brief Sends the coupling data by calling precice::writeBlockScalarData for each interface.
+	 * When subcycling, the data is only written at the end of the coupling window. If the written data is
+	 * averaged over the window, the data of every (sub)step is accumulated, and the window mean is written
 	 */
 	void writeCouplingData();
 
@@ -149,6 +337,63 @@ public:
 	 */
 	void adjustSolverTimeStep();
 
+	/**
+	 * @brief Returns the index of the coupling iteration in the current window (0 in the first iteration)
+	 */
+	int couplingIteration();
+
+	/**
+	 * @brief Returns the relative change of the read data in the current coupling iteration (1 if unknown)
+	 */
+	double couplingResidual();
+
+	/**
+	 * @brief Returns the relative tolerance that is sufficient for the current coupling iteration:
+	 * inexact-coupling-max-tolerance in the first iteration of a window, then proportional to the coupling residual.
+	 * Returns 0 if inexact coupling iterations are disabled, if the coupling is explicit, from the iteration
+	 * inexact-coupling-iterations of the window on, or if the coupling residual is below 100 times the relative
+	 * convergence limit of preCICE
+	 */
+	scalar inexactCouplingTolerance();
+
+	/**
+	 * @brief Loosens the relative tolerances of the linear solvers (except the Final ones) and the number of PIMPLE
+	 * outer correctors in fvSolution according to inexactCouplingTolerance(). The original controls are used when
+	 * the coupling is about to converge. Must be called after readCouplingData()
+	 */
+	void adjustSolverControls();
+
+	/**
+	 * @brief Returns true if the current iteration of a steady-state solver exchanges data with preCICE.
+	 * In the other iterations, the boundary values of the last coupling are kept
+	 */
+	bool isCouplingIteration();
+
+	/**
+	 * @brief Completes an iteration of a steady-state solver. After a coupling, the number of iterations until the
+	 * next coupling is adapted: it is doubled if the interface data changed less than the fluid residual, and halved otherwise
+	 */
+	void completeSteadyIteration();
+
+	/**
+	 * @brief Returns true once the interface data is stationary, such that a steady-state solver can stop iterating.
+	 * The solver must still exchange data and advance until isCouplingOngoing() is false, the other participant
+	 * does not know about this local criterion
+	 */
+	bool isInterfaceStationary();
+
+	/**
+	 * @brief Returns true if the fields must be written. With aligned output, this is the end of the coupling window
+	 * in which a write time of the controlDict has been reached, otherwise the write time itself
+	 */
+	bool isOutputTime();
+
+	/**
+	 * @brief Writes the fields if isOutputTime() or if writeNow is set, on a background thread with asynchronous output.
+	 * Must only be called if no checkpoint has been read in the current iteration
+	 */
+	void writeOutput( bool writeNow = false );
+
 	/**
 	 * @brief Returns true if the coupling is still ongoing
 	 */
@@ -205,10 +450,25 @@ public:
 	void addCheckpointField( surfaceScalarField & field );
 
 	/**
-	 * @brief Restores checkpointed fields and time
+	 * @brief Adds a derived volScalarField, which is not stored in the checkpoint but recomputed by the given callback
+	 * after the checkpointed fields have been restored. The callbacks are called in the order in which they are added
+	 */
+	void addCheckpointField( volScalarField & field, std::function<void()> recompute );
+
+	/**
+	 * @brief Restores checkpointed fields and time. The last coupling iterate of the warm-start fields is kept,
+	 * the accumulated write data of the repeated window is discarded.
+	 * The derived fields are recomputed from the restored fields
 	 */
 	void readCheckpoint();
 
+	/**
+	 * @brief Replaces the warm-start fields by their last coupling iterate, as initial guess of the linear solvers.
+	 * Only acts once after each readCheckpoint, in the first time step of the repeated window.
+	 * Must be called after the time is incremented, such that the old-time fields keep the checkpointed values
+	 */
+	void applyWarmStart();
+
 	/**
 	 * @brief Stores fields and time
 	 */
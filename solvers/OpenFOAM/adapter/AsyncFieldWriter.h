@@ -0,0 +1,93 @@
+#ifndef ASYNCFIELDWRITER_H
+#define ASYNCFIELDWRITER_H
+
+#include <thread>
+#include <vector>
+#include <string>
+#include <utility>
+#include <boost/log/trivial.hpp>
+#include "fvCFD.H"
+#include "OStringStream.H"
+
+namespace adapter
+{
+
+class AsyncFieldWriter
+{
+
+protected:
+
+	/**
+	 * @brief OpenFOAM mesh object, whose registered fields are written
+	 */
+	fvMesh & _mesh;
+
+	/**
+	 * @brief OpenFOAM Time object, which writes all objects that are not in the snapshot
+	 */
+	Foam::Time & _runTime;
+
+	/**
+	 * @brief Background thread that writes the snapshot
+	 */
+	std::thread _thread;
+
+	/**
+	 * @brief File path and serialized content (header, data and end divider) of each field of the snapshot
+	 */
+	std::vector<std::pair<fileName, std::string> > _snapshot;
+
+	/**
+	 * @brief Fields of the snapshot, which are excluded from the synchronous write of the other objects
+	 */
+	std::vector<regIOobject*> _snapshotFields;
+
+	/**
+	 * @brief Output settings of the snapshot, taken from the controlDict
+	 */
+	IOstream::streamFormat _format;
+	IOstream::compressionType _compression;
+
+	/**
+	 * @brief Serializes all registered fields of the given type that are written automatically into the snapshot
+	 */
+	template<class FieldType>
+	void _addToSnapshot();
+
+	/**
+	 * @brief Writes the serialized fields of the snapshot to their files, run on the background thread.
+	 * Only touches the snapshot, not the Time object, the registry or any IOobject
+	 */
+	void _writeSnapshot();
+
+public:
+
+	/**
+	 * @brief AsyncFieldWriter
+	 * @param mesh: OpenFOAM mesh object
+	 * @param runTime: OpenFOAM Time object
+	 */
+	AsyncFieldWriter( fvMesh & mesh, Foam::Time & runTime );
+
+	/**
+	 * @brief Writes all objects of the current time, like Time::writeNow(), after the previous snapshot has been written.
+	 * The volume and surface fields are serialized on the solver thread and their files are written on a background
+	 * thread. All other objects (time dictionary, uniform data, point fields, ...) are written on the solver thread
+	 */
+	void write();
+
+	/**
+	 * @brief Waits until the last snapshot has been written, and frees it
+	 */
+	void wait();
+
+	/**
+	 * @brief Destructor, waits for the last snapshot
+	 */
+	~AsyncFieldWriter();
+
+};
+
+}
+
+#endif // ASYNCFIELDWRITER_H
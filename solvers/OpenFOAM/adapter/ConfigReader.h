@@ -20,6 +20,7 @@ class ConfigReader
 	struct Interface {
 		std::string meshName;
 		std::vector<std::string> patchNames;
+		adapter::Interface::LocationsType locationsType;
 		std::vector<std::string> writeData;
 		std::vector<std::string> readData;
 		std::vector<struct Data> data;
@@ -30,6 +31,19 @@ protected:
 	YAML::Node _config;
 	std::vector<struct Interface> _interfaces;
 	std::string _preciceConfigFilename;
+	int _timeInterpolationOrder;
+	int _extrapolationOrder;
+	std::vector<std::string> _warmStartFieldNames;
+	bool _inexactCoupling;
+	double _inexactCouplingMaxTolerance;
+	int _inexactCouplingIterations;
+	bool _windowAveragedWriteData;
+	bool _evenSubsteps;
+	int _steadyCouplingInterval;
+	int _steadyCouplingMaxInterval;
+	double _steadyCouplingTolerance;
+	bool _alignedOutput;
+	bool _asynchronousOutput;
 	void checkFields( std::string filename, YAML::Node & config, std::string participantName );
 
 public:
@@ -45,6 +59,71 @@ public:
 		return _preciceConfigFilename;
 	}
 
+	int timeInterpolationOrder()
+	{
+		return _timeInterpolationOrder;
+	}
+
+	int extrapolationOrder()
+	{
+		return _extrapolationOrder;
+	}
+
+	std::vector<std::string> warmStartFieldNames()
+	{
+		return _warmStartFieldNames;
+	}
+
+	bool inexactCoupling()
+	{
+		return _inexactCoupling;
+	}
+
+	double inexactCouplingMaxTolerance()
+	{
+		return _inexactCouplingMaxTolerance;
+	}
+
+	int inexactCouplingIterations()
+	{
+		return _inexactCouplingIterations;
+	}
+
+	bool windowAveragedWriteData()
+	{
+		return _windowAveragedWriteData;
+	}
+
+	bool evenSubsteps()
+	{
+		return _evenSubsteps;
+	}
+
+	int steadyCouplingInterval()
+	{
+		return _steadyCouplingInterval;
+	}
+
+	int steadyCouplingMaxInterval()
+	{
+		return _steadyCouplingMaxInterval;
+	}
+
+	double steadyCouplingTolerance()
+	{
+		return _steadyCouplingTolerance;
+	}
+
+	bool alignedOutput()
+	{
+		return _alignedOutput;
+	}
+
+	bool asynchronousOutput()
+	{
+		return _asynchronousOutput;
+	}
+
 };
 
 }
@@ -14,6 +14,7 @@ protected:
 public:
 
 	virtual void read( double * dataBuffer ) = 0;
+
 	virtual ~CouplingDataReader()
 	{
 	}
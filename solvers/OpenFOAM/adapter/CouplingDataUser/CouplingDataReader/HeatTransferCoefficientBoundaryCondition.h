@@ -40,10 +40,10 @@ public:
 
 			int patchID = _patchIDs.at( k );
 
-			const fvPatch & kPatch =
-				refCast<const fvPatch>( _turbulence->kappaEff() ().mesh().boundary()[patchID] );
-            
-			scalarField myKDelta = _turbulence->kappaEff() ().boundaryField()[patchID] * kPatch.deltaCoeffs();
+			// Only the patch values of kappaEff are evaluated, not the whole field
+			const fvPatch & kPatch = _T.mesh().boundary()[patchID];
+
+			scalarField myKDelta = _turbulence->kappaEff( patchID ) * kPatch.deltaCoeffs();
 
 			mixedFvPatchScalarField & TPatch = refCast<mixedFvPatchScalarField>( _T.boundaryField()[patchID] );
            
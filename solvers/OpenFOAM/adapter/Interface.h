@@ -3,8 +3,11 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <boost/log/trivial.hpp>
 #include "fvCFD.H"
+#include "indirectPrimitivePatch.H"
+#include "syncTools.H"
 #include "CouplingDataUser/CouplingDataReader/CouplingDataReader.h"
 #include "CouplingDataUser/CouplingDataWriter/CouplingDataWriter.h"
 #include "precice/SolverInterface.hpp"
@@ -15,6 +18,15 @@ namespace adapter
 
 class Interface
 {
+public:
+
+	/**
+	 * @brief Locations at which the coupling data is exchanged with preCICE
+	 * faceCenters: Face centers of the patches, without connectivity (default)
+	 * faceNodes: Points of the patches, with the (triangulated) faces as connectivity
+	 */
+	enum LocationsType {faceCenters, faceNodes};
+
 protected:
 
 	/**
@@ -22,6 +34,11 @@ protected:
 	 */
 	precice::SolverInterface & _precice;
 
+	/**
+	 * @brief OpenFOAM's mesh
+	 */
+	fvMesh & _mesh;
+
 	/**
 	 * @brief Mesh name used in the preCICE configuration
 	 */
@@ -42,11 +59,21 @@ protected:
 	 */
 	std::vector<int> _patchIDs;
 
+	/**
+	 * @brief Locations at which the coupling data is exchanged with preCICE
+	 */
+	LocationsType _locationsType;
+
 	/**
 	 * @brief Number of vertices of the interface
 	 */
 	int _numDataLocations;
 
+	/**
+	 * @brief Number of patch faces of the interface (equal to _numDataLocations for face centers)
+	 */
+	int _numPatchFaces;
+
 	/**
 	 * @brief Vertex IDs assigned by preCICE
 	 */
@@ -62,6 +89,28 @@ protected:
 	 */
 	double * _dataBuffer;
 
+	/**
+	 * @brief Buffer for the coupling data at the face centers, used by the CouplingDataReaders and -Writers.
+	 * Points to _dataBuffer if the data is exchanged at the face centers
+	 */
+	double * _faceDataBuffer;
+
+	/**
+	 * @brief All patches of the interface as one patch, only used if the data is exchanged at the face nodes.
+	 * Its points are the vertices of the interface, its faces are in the order of _faceDataBuffer
+	 */
+	indirectPrimitivePatch * _interfacePatch;
+
+	/**
+	 * @brief Inverse distance weights of the local faces around each point of _interfacePatch
+	 */
+	List<scalarList> _pointFaceWeights;
+
+	/**
+	 * @brief Sum of the weights of all faces around each point of _interfacePatch, over all processors
+	 */
+	scalarField _pointWeightSums;
+
 	/**
 	 * @brief Vector of CouplingDataReaders
 	 */
@@ -73,11 +122,153 @@ protected:
 	std::vector<CouplingDataWriter*> _couplingDataWriters;
 
 	/**
-	 * @brief Extracts locations of face centers and exposes them to preCICE with setMeshVertices
-	 * TODO: Create a mesh of nodes instead of face centers?
+	 * @brief Order of the interpolation of the read data in time (0: constant, 1: linear, 2: quadratic)
+	 */
+	int _timeInterpolationOrder;
+
+	/**
+	 * @brief Order of the extrapolation of the read data at the start of a window (0: none, 1: linear, 2: quadratic)
+	 */
+	int _extrapolationOrder;
+
+	/**
+	 * @brief Latest data received for each CouplingDataReader, which belongs to the end of the current window
+	 */
+	std::vector<double*> _readDataWindowEnd;
+
+	/**
+	 * @brief Converged data at the start of the current window (index 0) and of the previous windows (index 1, 2),
+	 * for each CouplingDataReader
+	 */
+	std::vector< std::vector<double*> > _readDataHistory;
+
+	/**
+	 * @brief Number of valid entries in the history of the read data
+	 */
+	int _numStoredWindows;
+
+	/**
+	 * @brief True if no data has been received yet in the current window
+	 */
+	bool _isNewWindow;
+
+	/**
+	 * @brief True if the data received in a new window already belongs to the end of that window, which is the case
+	 * for the second participant of a serial coupling scheme. Otherwise, the first data received in a new window is
+	 * the converged data at the end of the previous window
+	 */
+	bool _isReadDataOfCurrentWindow;
+
+	/**
+	 * @brief Previously received data for each CouplingDataReader, to measure the change of the read data
+	 */
+	std::vector<double*> _readDataPrevious;
+
+	/**
+	 * @brief Squared norm of the change of the latest received data and squared norm of the latest received data
+	 */
+	double _readDataSquaredChange;
+	double _readDataSquaredNorm;
+
+	/**
+	 * @brief Previously written data for each CouplingDataWriter, to measure the change of the written data
+	 */
+	std::vector<double*> _writeDataPrevious;
+
+	/**
+	 * @brief Squared norm of the change of the latest written data and squared norm of the latest written data
+	 */
+	double _writeDataSquaredChange;
+	double _writeDataSquaredNorm;
+
+	/**
+	 * @brief Whether the data of the CouplingDataWriters is averaged in time over the coupling window
+	 */
+	bool _windowAveragedWriteData;
+
+	/**
+	 * @brief Time integral of the face values of each CouplingDataWriter over the computed part of the window
+	 * (weighted by the heat transfer coefficient for the sink temperature), and the length of that part
+	 */
+	std::vector<double*> _writeDataIntegrals;
+	double _writeDataIntegrationTime;
+
+	/**
+	 * @brief Indices of the CouplingDataWriters of the heat transfer coefficient and of the sink temperature (-1 if none)
+	 */
+	int _heatTransferCoefficientWriter;
+	int _sinkTemperatureWriter;
+
+	/**
+	 * @brief Face values of the heat transfer coefficient in the current (sub)step
+	 */
+	double * _heatTransferCoefficientBuffer;
+
+	/**
+	 * @brief Adds the change of the data received for the i-th CouplingDataReader to the squared norms, and keeps the data
+	 */
+	void _updateReadDataChange( uint i, double * buffer );
+
+	/**
+	 * @brief Shifts the history of the read data of the i-th CouplingDataReader by one window, and stores the given
+	 * data as the start of the current window
+	 */
+	void _pushReadDataHistory( uint i, double * windowStart );
+
+	/**
+	 * @brief Exposes the interface mesh to preCICE, depending on the locations type
 	 */
 	void _configureMesh( fvMesh & mesh );
 
+	/**
+	 * @brief Extracts locations of face centers and exposes them to preCICE with setMeshVertices
+	 */
+	void _configureFaceCentersMesh( fvMesh & mesh );
+
+	/**
+	 * @brief Extracts the points of the patches and exposes them to preCICE with setMeshVertices.
+	 * The faces are triangulated and exposed with setMeshTriangleWithEdges, such that preCICE
+	 * can use projection-based mappings
+	 */
+	void _configureFaceNodesMesh( fvMesh & mesh );
+
+	/**
+	 * @brief Reads the data of a CouplingDataReader from preCICE into the given buffer
+	 */
+	void _readBlockData( CouplingDataReader * couplingDataReader, double * buffer );
+
+	/**
+	 * @brief Passes the data in the given buffer to the i-th CouplingDataReader, interpolating it to the faces if needed
+	 */
+	void _applyReadData( uint i, double * buffer );
+
+	/**
+	 * @brief Interpolates the data of the i-th CouplingDataReader in time and writes it into _dataBuffer
+	 * @param i: Index of the CouplingDataReader
+	 * @param windowFraction: Fraction of the current window that has been computed (0 at the start, 1 at the end)
+	 * @param windowSizeRatio: Ratio of the previous window size to the current window size
+	 */
+	void _interpolateReadData( uint i, double windowFraction, double windowSizeRatio );
+
+	/**
+	 * @brief Extrapolates the converged data of the past windows of the i-th CouplingDataReader to the end of the
+	 * current window, which is used as initial guess in the first iteration of the window
+	 * @param i: Index of the CouplingDataReader
+	 * @param windowSizeRatio: Ratio of the previous window size to the current window size
+	 */
+	void _extrapolateReadData( uint i, double windowSizeRatio );
+
+	/**
+	 * @brief Interpolates scalar data from the face centers to the face nodes of the interface.
+	 * Synchronizes the processors, so it is called on all ranks (with NULL buffers on ranks without faces)
+	 */
+	void _interpolateFacesToNodes( double * faceData, double * nodeData );
+
+	/**
+	 * @brief Interpolates scalar data from the face nodes to the face centers of the interface
+	 */
+	void _interpolateNodesToFaces( double * nodeData, double * faceData );
+
 public:
 
 	/**
@@ -86,11 +277,13 @@ public:
 	 * @param mesh: OpenFOAM's mesh
 	 * @param meshName: Mesh name assigned to the interface in the preCICE configuration
 	 * @param patchNames: Vector of patch names that make up the interface
+	 * @param locationsType: Locations at which the coupling data is exchanged (face centers by default)
 	 */
 	Interface( precice::SolverInterface & precice,
 			   fvMesh & mesh,
 			   std::string meshName,
-			   std::vector<std::string> patchNames
+			   std::vector<std::string> patchNames,
+			   LocationsType locationsType = faceCenters
 			   );
 
 	/**
@@ -103,15 +296,64 @@ public:
 	 */
 	void addCouplingDataWriter( std::string dataName, CouplingDataWriter * couplingDataWriter );
 
+	/**
+	 * @brief Returns the number of patch faces of the interface owned by this rank
+	 */
+	int getNumPatchFaces();
+
+	/**
+	 * @brief Sets the orders of the interpolation in time and of the extrapolation of the read data,
+	 * and allocates the history of the read data. Must be called after all CouplingDataReaders have been added
+	 * @param isReadDataOfCurrentWindow: True if the data received in a new window belongs to the end of that window
+	 * (second participant of a serial coupling scheme)
+	 */
+	void setReadDataOrders( int timeInterpolationOrder, int extrapolationOrder, bool isReadDataOfCurrentWindow = false );
+
+	/**
+	 * @brief Enables the averaging of the written data in time over the coupling window, and allocates the time integrals.
+	 * Must be called after all CouplingDataWriters have been added
+	 */
+	void setWindowAveragedWriteData( bool windowAveragedWriteData );
+
+	/**
+	 * @brief Adds the data of each CouplingDataWriter at the end of a (sub)step of the given size to the time integrals
+	 */
+	void accumulateWriteData( double timeStep );
+
+	/**
+	 * @brief Discards the time integrals of the written data, e.g. when the window is repeated
+	 */
+	void resetWriteData();
+
+	/**
+	 * @brief Marks the start of a new coupling window: the next data received is the converged data of the previous window
+	 */
+	void moveToNextWindow();
+
 	/**
 	 * @brief Calls read() on each couplingDataReader to read the coupling data from the buffer
 	 * and apply the boundary conditions
+	 * @param windowFraction: Fraction of the current window that has been computed, used for the time interpolation
+	 * @param windowSizeRatio: Ratio of the previous window size to the current window size, used for the quadratic interpolation
+	 */
+	void readCouplingData( double windowFraction = 1, double windowSizeRatio = 1 );
+
+	/**
+	 * @brief Adds the squared norm of the change of the latest received data (with respect to the data received before)
+	 * and the squared norm of the latest received data of this rank
+	 */
+	void addReadDataChange( double & squaredChange, double & squaredNorm );
+
+	/**
+	 * @brief Adds the squared norm of the change of the latest written data (with respect to the data written before)
+	 * and the squared norm of the latest written data of this rank
 	 */
-	void readCouplingData();
+	void addWriteDataChange( double & squaredChange, double & squaredNorm );
 
 	/**
 	 * @brief Calls write() on each couplingDataWriter to extract the boundary data and write it
-	 * into the buffer
+	 * into the buffer. If the written data is averaged over the window, the mean of the time integrals is written
+	 * instead, and the integrals are reset
 	 */
 	void writeCouplingData();
 